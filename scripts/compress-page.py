@@ -0,0 +1,47 @@
+# Compresses web/setup.html into src/web-page.h before every build.
+# The header is rewritten only when the page changes, so no extra rebuilds.
+import gzip
+import hashlib
+import os
+
+Import("env")
+
+PROJECT_DIR = env.subst("$PROJECT_DIR")
+SOURCE = os.path.join(PROJECT_DIR, "web", "setup.html")
+TARGET = os.path.join(PROJECT_DIR, "src", "web-page.h")
+
+
+def generate():
+    with open(SOURCE, "rb") as f:
+        html = f.read()
+
+    # mtime=0 keeps the output (and the ETag) stable between builds
+    compressed = gzip.compress(html, compresslevel=9, mtime=0)
+    etag = hashlib.sha1(compressed).hexdigest()[:16]
+
+    lines = [
+        "// Generated by scripts/compress-page.py from web/setup.html, do not edit",
+        "#ifndef _WEB_PAGE_H_",
+        "#define _WEB_PAGE_H_",
+        "#include <Arduino.h>",
+        "",
+        "// %d bytes, %d before compression" % (len(compressed), len(html)),
+        "#define HTML_PAGE_ETAG \"\\\"%s\\\"\"" % etag,
+        "",
+        "const uint8_t htmlPageGz[] PROGMEM = {",
+    ]
+    for i in range(0, len(compressed), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in compressed[i:i + 16]) + ",")
+    lines += ["};", "", "#endif", ""]
+    content = "\n".join(lines)
+
+    if os.path.exists(TARGET):
+        with open(TARGET, "r") as f:
+            if f.read() == content:
+                return
+    with open(TARGET, "w") as f:
+        f.write(content)
+    print("web-page.h: %d -> %d bytes" % (len(html), len(compressed)))
+
+
+generate()
@@ -0,0 +1,42 @@
+#include "batcher.h"
+
+void batcherInit(DatagramBatcher_t* batcher, DatagramSend_t send) {
+    batcher->length = 0;
+    batcher->firstByteTime = 0;
+    batcher->send = send;
+    batcher->datagrams = 0;
+    batcher->bytes = 0;
+}
+
+uint8_t* batcherReserve(DatagramBatcher_t* batcher, uint16_t length, uint32_t now) {
+    if (length > DATAGRAM_MTU) return NULL;
+
+    if (batcher->length + length > DATAGRAM_MTU) {
+        batcherFlush(batcher);
+    }
+    if (batcher->length == 0) {
+        batcher->firstByteTime = now;
+    }
+    return batcher->buffer + batcher->length;
+}
+
+void batcherCommit(DatagramBatcher_t* batcher, uint16_t length) {
+    batcher->length += length;
+}
+
+void batcherPoll(DatagramBatcher_t* batcher, uint32_t now, bool idle) {
+    if (batcher->length == 0) return;
+
+    if (idle || now - batcher->firstByteTime >= DATAGRAM_FLUSH_DEADLINE_US) {
+        batcherFlush(batcher);
+    }
+}
+
+void batcherFlush(DatagramBatcher_t* batcher) {
+    if (batcher->length == 0) return;
+
+    batcher->send(batcher->buffer, batcher->length);
+    batcher->datagrams++;
+    batcher->bytes += batcher->length;
+    batcher->length = 0;
+}
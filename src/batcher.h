@@ -0,0 +1,30 @@
+#ifndef _BATCHER_H_
+#define _BATCHER_H_
+#include <Arduino.h>
+
+#define DATAGRAM_MTU                1472    // UDP payload of a 1500 bytes Ethernet/WiFi frame
+#define DATAGRAM_FLUSH_DEADLINE_US  5000    // max time the first byte waits in the datagram
+
+typedef void (*DatagramSend_t)(const uint8_t* data, uint16_t length);
+
+// Packs encoded messages into datagrams up to the MTU
+struct DatagramBatcher_t {
+    uint8_t buffer[DATAGRAM_MTU];
+    uint16_t length;
+    uint32_t firstByteTime;     // us
+    DatagramSend_t send;
+    // Statistic
+    uint32_t datagrams;
+    uint32_t bytes;
+};
+
+void batcherInit(DatagramBatcher_t* batcher, DatagramSend_t send);
+
+// Returns room for 'length' bytes, flushes first if they do not fit
+uint8_t* batcherReserve(DatagramBatcher_t* batcher, uint16_t length, uint32_t now);
+void batcherCommit(DatagramBatcher_t* batcher, uint16_t length);
+
+// Flushes when the deadline has expired, or always if idle (no more input pending)
+void batcherPoll(DatagramBatcher_t* batcher, uint32_t now, bool idle);
+void batcherFlush(DatagramBatcher_t* batcher);
+#endif
@@ -0,0 +1,482 @@
+#include <Arduino.h>
+#include "benchmark.h"
+#include "crc.h"
+#include "crsf.h"
+#include "mavlink.h"
+#include "scheduler.h"
+#include "vehicles.h"
+#include "mavlink-reference.h"
+#ifndef BENCHMARK_ON_TARGET
+#include <time.h>
+#include "pipeline.h"
+#endif
+
+#ifdef BENCHMARK_ON_TARGET
+#define benchPrint(...) Serial.printf(__VA_ARGS__)
+
+static inline uint32_t benchTicks() {
+    return ESP.getCycleCount();
+}
+
+static inline uint32_t ticksToNs(uint32_t ticks) {
+    return ticks * 1000ULL / ESP.getCpuFreqMHz();
+}
+
+#define BENCH_TICK_UNIT "cycles"
+#else
+#define benchPrint(...) printf(__VA_ARGS__)
+
+static inline uint32_t benchTicks() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+static inline uint32_t ticksToNs(uint32_t ticks) {
+    return ticks;
+}
+
+#define BENCH_TICK_UNIT "ns"
+#endif
+
+#define BENCHMARK_SAMPLES   (BENCHMARK_FRAMES * BENCHMARK_ROUNDS)
+#define BENCHMARK_FRAME_LEN 48
+#define ELRS_PACKET_INTERVAL_US 2000    // 500 Hz packet rate
+
+// ESP-NOW payload: MSP v2 envelope around one CRSF frame
+struct BenchFrame_t {
+    uint8_t msp[BENCHMARK_FRAME_LEN];
+    uint8_t mspLen;
+    uint8_t crsfLen;    // CRSF frame starts at MSP_V2_HEADER_LEN
+    uint32_t groups;    // TELEMETRY_* group it updates
+};
+
+// Weights of GPS, battery, attitude and flight mode frames.
+// ratio is the ELRS telemetry ratio 1:N, 0 for a frame every ELRS packet.
+// The ratio mixes only run the pipeline stage, the others do not depend on it.
+struct FrameMix_t {
+    const char* name;
+    uint8_t weight[TELEMETRY_GROUPS];
+    uint16_t ratio;
+};
+
+static const FrameMix_t frameMixes[] = {
+    { "gps-heavy",      { 5, 2, 2, 1 }, 0 },
+    { "attitude-heavy", { 1, 1, 7, 1 }, 0 },
+    { "elrs 1:2",       { 2, 1, 4, 1 }, 2 },
+    { "elrs 1:8",       { 2, 1, 4, 1 }, 8 },
+    { "elrs 1:32",      { 2, 1, 4, 1 }, 32 },
+    { "elrs 1:128",     { 2, 1, 4, 1 }, 128 },
+};
+
+static BenchFrame_t frames[BENCHMARK_FRAMES];
+static uint32_t samples[BENCHMARK_SAMPLES];
+static TelemetryData_t telemetry;
+static uint8_t mavBuffer[512];
+static uint32_t randomState;
+
+static uint32_t benchRandom() {
+    randomState = randomState * 1664525u + 1013904223u;
+    return randomState >> 8;
+}
+
+static void putBE16(uint8_t* buf, int16_t value) { buf[0] = value >> 8; buf[1] = value; }
+static void putBE32(uint8_t* buf, int32_t value) { putBE16(buf, value >> 16); putBE16(buf + 2, value); }
+
+// CRSF frame [address][length][type][payload][crc] wrapped into MSP v2
+static void makeFrame(BenchFrame_t* frame, int group, int index) {
+    uint8_t* crsf = frame->msp + 8;
+    uint8_t* payload = crsf + 3;
+    int payloadLen = 0;
+
+    switch (group) {
+        case TELEMETRY_GROUP_GPS:
+            crsf[2] = 0x02;
+            putBE32(payload, 557500000 + index * 10);
+            putBE32(payload + 4, 376100000 - index * 10);
+            putBE16(payload + 8, 123);
+            putBE16(payload + 10, 9000 + index);
+            putBE16(payload + 12, 1150);
+            payload[14] = 12;
+            payloadLen = 15;
+            break;
+        case TELEMETRY_GROUP_BATTERY:
+            crsf[2] = 0x08;
+            putBE16(payload, 158 - index % 20);
+            putBE16(payload + 2, 123);
+            payload[4] = 0;
+            putBE16(payload + 5, 1200 + index);
+            payload[7] = 80;
+            payloadLen = 8;
+            break;
+        case TELEMETRY_GROUP_ATTITUDE:
+            crsf[2] = 0x1E;
+            putBE16(payload, (index * 37) % 6000 - 3000);
+            putBE16(payload + 2, (index * 53) % 6000 - 3000);
+            putBE16(payload + 4, (index * 11) % 31415);
+            payloadLen = 6;
+            break;
+        default:
+            crsf[2] = 0x21;
+            memcpy(payload, index & 1 ? "ANGL" : "ACRO*", 6);
+            payloadLen = 6;
+            break;
+    }
+
+    crsf[0] = 0xC8;
+    crsf[1] = payloadLen + 2;
+    crsf[payloadLen + 3] = crc8DvbS2(0, crsf + 2, payloadLen + 1);
+    frame->crsfLen = payloadLen + 4;
+    frame->groups = 1 << group;
+
+    // MSP v2: $X< flag function size payload crc
+    uint8_t* msp = frame->msp;
+    msp[0] = '$';
+    msp[1] = 'X';
+    msp[2] = '<';
+    msp[3] = 0;
+    msp[4] = 0x11;      // MSP_ELRS_BACKPACK_CRSF_TLM
+    msp[5] = 0;
+    msp[6] = frame->crsfLen;
+    msp[7] = 0;
+    msp[8 + frame->crsfLen] = crc8DvbS2(0, msp + 3, 5 + frame->crsfLen);
+    frame->mspLen = 9 + frame->crsfLen;
+}
+
+static void makeFrames(const FrameMix_t* mix) {
+    int total = 0;
+    for (int group = 0; group < TELEMETRY_GROUPS; group++) {
+        total += mix->weight[group];
+    }
+
+    randomState = 12345;
+    for (int i = 0; i < BENCHMARK_FRAMES; i++) {
+        int pick = benchRandom() % total;
+        int group = 0;
+        while (pick >= mix->weight[group]) {
+            pick -= mix->weight[group++];
+        }
+        makeFrame(&frames[i], group, i);
+    }
+}
+
+static int compareSamples(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static void report(const char* stage, const char* mix, int count, uint64_t bytes) {
+    uint64_t total = 0;
+    for (int i = 0; i < count; i++) {
+        samples[i] = ticksToNs(samples[i]);
+        total += samples[i];
+    }
+    qsort(samples, count, sizeof(uint32_t), compareSamples);
+
+    benchPrint("%-18s %-15s %6d %10lu %8lu %8lu %10.1f\n", stage, mix, count,
+               (unsigned long)(total / count), (unsigned long)samples[count / 2],
+               (unsigned long)samples[count * 99 / 100], (double)bytes / count);
+}
+
+// CRSF CRC8 as it was computed before the lookup table
+static uint32_t crc8Bitwise(const uint8_t* data, int len) {
+    uint8_t crc = 0;
+    for (int i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int j = 0; j < 8; j++) {
+            crc = crc & 0x80 ? (crc << 1) ^ 0xD5 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+typedef uint32_t (*Checksum_t)(const uint8_t* data, int len);
+
+static uint32_t crc8Table(const uint8_t* data, int len) { return crc8DvbS2(0, data, len); }
+
+// MAVLink CRC16-MCRF4XX: shift-xor reference, one table and crc_calculate
+// (slice-by-4 when MAVLINK_CRC_SLICE_BY_4 is defined)
+static uint32_t crc16Reference(const uint8_t* data, int len) {
+    uint16_t crc = X25_INIT_CRC;
+    for (int i = 0; i < len; i++) {
+        uint8_t tmp = data[i] ^ (uint8_t)(crc & 0xff);
+        tmp ^= (tmp << 4);
+        crc = (crc >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4);
+    }
+    return crc;
+}
+
+static uint32_t crc16Table(const uint8_t* data, int len) {
+    uint16_t crc = X25_INIT_CRC;
+    for (int i = 0; i < len; i++) {
+        crc = (crc >> 8) ^ crc_mcrf4xx_table[0][(uint8_t)(crc ^ data[i])];
+    }
+    return crc;
+}
+
+static uint32_t crc16Calculate(const uint8_t* data, int len) {
+    return crc_calculate(data, len);
+}
+
+static void benchChecksum(const char* stage, Checksum_t checksum, const uint8_t* data, int len) {
+    volatile uint32_t crc;
+    char name[16];
+    snprintf(name, sizeof(name), "%d bytes", len);
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        uint32_t start = benchTicks();
+        crc = checksum(data, len);
+        samples[i] = benchTicks() - start;
+    }
+    (void)crc;
+    report(stage, name, BENCHMARK_SAMPLES, (uint64_t)len * BENCHMARK_SAMPLES);
+}
+
+// Bitwise against table CRC8 over the CRSF frame sizes, and the CRC16
+// variants over MAVLink message sizes
+static void benchChecksums() {
+    static const int crc8Sizes[] = { 8, 16, 32, 64 };
+    static const int crc16Sizes[] = { 21, 40, 64, 280 };
+    uint8_t data[280];
+
+    randomState = 12345;
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = benchRandom();
+    }
+
+    for (size_t s = 0; s < sizeof(crc8Sizes) / sizeof(crc8Sizes[0]); s++) {
+        int len = crc8Sizes[s];
+        if (crc8Bitwise(data, len) != crc8Table(data, len)) {
+            benchPrint("crc8 mismatch at %d bytes\n", len);
+        }
+        benchChecksum("crc8 bitwise", crc8Bitwise, data, len);
+        benchChecksum("crc8 table", crc8Table, data, len);
+    }
+
+    for (size_t s = 0; s < sizeof(crc16Sizes) / sizeof(crc16Sizes[0]); s++) {
+        int len = crc16Sizes[s];
+        if (crc16Reference(data, len) != crc16Table(data, len) || crc16Reference(data, len) != crc16Calculate(data, len)) {
+            benchPrint("crc16 mismatch at %d bytes\n", len);
+        }
+        benchChecksum("crc16 reference", crc16Reference, data, len);
+        benchChecksum("crc16 table", crc16Table, data, len);
+#ifdef MAVLINK_CRC_SLICE_BY_4
+        benchChecksum("crc16 slice-by-4", crc16Calculate, data, len);
+#endif
+    }
+}
+
+static void benchParse(const FrameMix_t* mix) {
+    memset(&telemetry, 0, sizeof(telemetry));
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        const BenchFrame_t* frame = &frames[i % BENCHMARK_FRAMES];
+        uint32_t start = benchTicks();
+        parseCRSFPacket(frame->msp + 8, frame->crsfLen, &telemetry);
+        samples[i] = benchTicks() - start;
+    }
+    report("crsf parse", mix->name, BENCHMARK_SAMPLES, 0);
+}
+
+// Encodes the messages affected by every frame, as the event-driven mode does
+static void benchBuild(const FrameMix_t* mix) {
+    uint64_t bytes = 0;
+    memset(&telemetry, 0, sizeof(telemetry));
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        const BenchFrame_t* frame = &frames[i % BENCHMARK_FRAMES];
+        parseCRSFPacket(frame->msp + 8, frame->crsfLen, &telemetry);
+        uint32_t messages = schedulerMessagesOf(frame->groups);
+
+        uint32_t start = benchTicks();
+        bytes += buildMAVLinkDataStream(&telemetry, 1, messages, mavBuffer);
+        samples[i] = benchTicks() - start;
+    }
+    report("mavlink build", mix->name, BENCHMARK_SAMPLES, bytes);
+}
+
+// The bridge messages in stream order
+struct BenchMessage_t {
+    const char* name;
+    int slot;
+    uint32_t msgId;
+    uint8_t payloadLen;     // full payload, before the MAVLink 2 trimming
+};
+
+static const BenchMessage_t benchMessages[] = {
+    { "GPS_RAW_INT",         SCHEDULED_GPS_RAW_INT,         MAVLINK_MSG_ID_GPS_RAW_INT,         MAVLINK_MSG_ID_GPS_RAW_INT_LEN },
+    { "GLOBAL_POSITION_INT", SCHEDULED_GLOBAL_POSITION_INT, MAVLINK_MSG_ID_GLOBAL_POSITION_INT, MAVLINK_MSG_ID_GLOBAL_POSITION_INT_LEN },
+    { "ATTITUDE",            SCHEDULED_ATTITUDE,            MAVLINK_MSG_ID_ATTITUDE,            MAVLINK_MSG_ID_ATTITUDE_LEN },
+    { "HEARTBEAT",           SCHEDULED_HEARTBEAT,           MAVLINK_MSG_ID_HEARTBEAT,           MAVLINK_MSG_ID_HEARTBEAT_LEN },
+    { "SYS_STATUS",          SCHEDULED_SYS_STATUS,          MAVLINK_MSG_ID_SYS_STATUS,          MAVLINK_MSG_ID_SYS_STATUS_LEN },
+};
+
+#define BENCH_MESSAGES  (sizeof(benchMessages) / sizeof(benchMessages[0]))
+
+// Position messages only go out with a GPS fix, ATTITUDE once it was received
+static bool messageEnabled(const BenchMessage_t* message) {
+    switch (message->slot) {
+        case SCHEDULED_GPS_RAW_INT:
+        case SCHEDULED_GLOBAL_POSITION_INT:
+            return telemetry.gps.enabled;
+        case SCHEDULED_ATTITUDE:
+            return telemetry.attitude.enabled;
+        default:
+            return true;
+    }
+}
+
+// The same messages with the generated pack + mavlink_msg_to_send_buffer
+static uint16_t packReference(uint32_t messages) {
+    static uint8_t sequence = 0;
+    uint16_t length = 0;
+
+    for (size_t m = 0; m < BENCH_MESSAGES; m++) {
+        const BenchMessage_t* message = &benchMessages[m];
+        if ((messages & SCHEDULED_BIT(message->slot)) && messageEnabled(message)) {
+            length += mavlinkWriteReference(&telemetry, 1, message->msgId, sequence++, mavBuffer + length);
+        }
+    }
+    return length;
+}
+
+static void benchReference(const FrameMix_t* mix) {
+    uint64_t bytes = 0;
+    memset(&telemetry, 0, sizeof(telemetry));
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        const BenchFrame_t* frame = &frames[i % BENCHMARK_FRAMES];
+        parseCRSFPacket(frame->msp + 8, frame->crsfLen, &telemetry);
+        uint32_t messages = schedulerMessagesOf(frame->groups);
+
+        uint32_t start = benchTicks();
+        bytes += packReference(messages);
+        samples[i] = benchTicks() - start;
+    }
+    report("mavlink pack ref", mix->name, BENCHMARK_SAMPLES, bytes);
+}
+
+static uint32_t meanTicks(int count) {
+    uint64_t total = 0;
+    for (int i = 0; i < count; i++) {
+        total += samples[i];
+    }
+    return total / count;
+}
+
+// Direct-to-wire writer against pack + mavlink_msg_to_send_buffer, one message
+// at a time and always encoded (system IDs past MAX_VEHICLES are not cached).
+// Copied bytes: the wire bytes for the direct writer. For the generated code
+// the payload into mavlink_message_t, its header and checksum fields, then
+// the whole message again into the send buffer.
+static void benchMessageCosts() {
+    const uint8_t systemId = MAX_VEHICLES + 1;
+    uint8_t reference[MAVLINK_MAX_PACKET_LEN];
+
+    makeFrames(&frameMixes[0]);
+    memset(&telemetry, 0, sizeof(telemetry));
+    for (int i = 0; i < BENCHMARK_FRAMES; i++) {
+        parseCRSFPacket(frames[i].msp + 8, frames[i].crsfLen, &telemetry);
+    }
+
+    benchPrint("\n%-20s %11s %11s %11s %6s %14s %14s\n", "message", "direct", "pack+send", "saved",
+               "wire", "copied direct", "copied pack");
+    for (size_t m = 0; m < BENCH_MESSAGES; m++) {
+        const BenchMessage_t* message = &benchMessages[m];
+        uint32_t messages = SCHEDULED_BIT(message->slot);
+        uint64_t wireBytes = 0;
+
+        for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+            const BenchFrame_t* frame = &frames[i % BENCHMARK_FRAMES];
+            parseCRSFPacket(frame->msp + 8, frame->crsfLen, &telemetry);
+            uint32_t start = benchTicks();
+            wireBytes += buildMAVLinkDataStream(&telemetry, systemId, messages, mavBuffer);
+            samples[i] = benchTicks() - start;
+        }
+        uint32_t direct = meanTicks(BENCHMARK_SAMPLES);
+
+        for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+            const BenchFrame_t* frame = &frames[i % BENCHMARK_FRAMES];
+            parseCRSFPacket(frame->msp + 8, frame->crsfLen, &telemetry);
+            uint32_t start = benchTicks();
+            mavlinkWriteReference(&telemetry, systemId, message->msgId, i, reference);
+            samples[i] = benchTicks() - start;
+        }
+        uint32_t generated = meanTicks(BENCHMARK_SAMPLES);
+
+        // Both encodings of the last telemetry have to be the same bytes
+        uint16_t length = buildMAVLinkDataStream(&telemetry, systemId, messages, mavBuffer);
+        if (length != mavlinkWriteReference(&telemetry, systemId, message->msgId, mavBuffer[4], reference) ||
+            memcmp(mavBuffer, reference, length) != 0) {
+            benchPrint("%s: direct and generated encodings differ\n", message->name);
+        }
+
+        double wire = (double)wireBytes / BENCHMARK_SAMPLES;
+        benchPrint("%-20s %11lu %11lu %11ld %6.1f %14.1f %14.1f\n", message->name,
+                   (unsigned long)direct, (unsigned long)generated, (long)generated - (long)direct,
+                   wire, wire, message->payloadLen + MAVLINK_NUM_NON_PAYLOAD_BYTES + wire);
+    }
+    benchPrint("(%s per message, bytes per message)\n", BENCH_TICK_UNIT);
+}
+
+#ifndef BENCHMARK_ON_TARGET
+static uint64_t pipelineBytes;
+
+static void countDatagram(const uint8_t*, uint16_t length) {
+    pipelineBytes += length;
+}
+
+// Whole path with the rate limits, frames spaced by the telemetry ratio
+// on the virtual clock of the host build
+static void benchPipeline(const FrameMix_t* mix) {
+    uint64_t time = hostClockNow() + 1000000;
+    uint32_t interval = (mix->ratio ? mix->ratio : 1) * ELRS_PACKET_INTERVAL_US;
+    static const uint8_t mac[6] = { 0x4E, 0x52, 0xA6, 0xFB, 0x23, 0xEA };
+
+    pipelineInit(countDatagram);
+    pipelineBytes = 0;
+
+    for (int i = 0; i < BENCHMARK_SAMPLES; i++) {
+        const BenchFrame_t* frame = &frames[i % BENCHMARK_FRAMES];
+        time += interval;
+        hostClockSet(time);
+
+        uint32_t start = benchTicks();
+        pipelinePush(mac, frame->msp, frame->mspLen);
+        pipelineDrain();
+        pipelineSendScheduled();
+        samples[i] = benchTicks() - start;
+    }
+    report("pipeline", mix->name, BENCHMARK_SAMPLES, pipelineBytes);
+}
+#endif
+
+void benchmarkRun() {
+    benchPrint("%-18s %-15s %6s %10s %8s %8s %10s\n",
+               "stage", "mix", "frames", "ns/frame", "p50", "p99", "bytes/frame");
+
+    benchChecksums();
+
+    for (size_t m = 0; m < sizeof(frameMixes) / sizeof(frameMixes[0]); m++) {
+        const FrameMix_t* mix = &frameMixes[m];
+#ifdef BENCHMARK_ON_TARGET
+        // The ratio only spaces the frames, so it matters for the pipeline alone
+        if (mix->ratio) {
+            benchPrint("%-18s %-15s skipped, runs on the host virtual clock only\n", "pipeline", mix->name);
+            continue;
+        }
+#endif
+        makeFrames(mix);
+
+        if (mix->ratio == 0) {
+            benchParse(mix);
+            benchBuild(mix);
+            benchReference(mix);
+        }
+#ifndef BENCHMARK_ON_TARGET
+        benchPipeline(mix);
+#endif
+    }
+    benchMessageCosts();
+}
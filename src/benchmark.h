@@ -0,0 +1,11 @@
+#ifndef _BENCHMARK_H_
+#define _BENCHMARK_H_
+
+// CRSF -> MAVLink path benchmark over synthetic frame mixes.
+// Host: timed with the monotonic clock. On target (BENCHMARK_ON_TARGET):
+// timed with the CPU cycle counter, results go to the serial port.
+#define BENCHMARK_FRAMES    256     // generated frames per mix
+#define BENCHMARK_ROUNDS    4       // passes over the frames
+
+void benchmarkRun();
+#endif
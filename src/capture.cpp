@@ -0,0 +1,88 @@
+#include <esp_timer.h>
+#include "capture.h"
+
+static const uint8_t emptyCapture[CAPTURE_MAGIC_LEN] = {
+    'E', 'N', 'O', 'W', 'C', 'A', 'P', '1'
+};
+
+static uint8_t* captureBuffer = NULL;           // allocated by captureStart
+static volatile uint32_t captureLength = 0;     // published bytes
+static volatile bool captureArmed = false;
+static volatile bool captureWriting = false;    // captureFrame inside the buffer
+static bool captureDownloading = false;
+
+// Stops recording and waits for the frame being written, if any.
+// Both flags are sequentially consistent, so either captureFrame sees the
+// disarm or we see it writing.
+static void captureDisarm() {
+    __atomic_store_n(&captureArmed, false, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&captureWriting, __ATOMIC_SEQ_CST)) {
+        delay(1);
+    }
+}
+
+bool captureStart() {
+    if (captureDownloading) return false;
+    captureDisarm();
+    if (captureBuffer == NULL) {
+        captureBuffer = (uint8_t*)malloc(CAPTURE_BUFFER_SIZE);
+        if (captureBuffer == NULL) return false;
+    }
+    memcpy(captureBuffer, CAPTURE_MAGIC, CAPTURE_MAGIC_LEN);
+    __atomic_store_n(&captureLength, CAPTURE_MAGIC_LEN, __ATOMIC_RELEASE);
+    __atomic_store_n(&captureArmed, true, __ATOMIC_SEQ_CST);
+    return true;
+}
+
+void IRAM_ATTR captureFrame(const uint8_t* mac, const uint8_t* data, int len) {
+    if (!__atomic_load_n(&captureArmed, __ATOMIC_ACQUIRE)) return;
+
+    __atomic_store_n(&captureWriting, true, __ATOMIC_SEQ_CST);
+    if (!__atomic_load_n(&captureArmed, __ATOMIC_SEQ_CST)) {
+        __atomic_store_n(&captureWriting, false, __ATOMIC_RELEASE);
+        return;
+    }
+
+    uint32_t base = __atomic_load_n(&captureLength, __ATOMIC_ACQUIRE);
+    uint32_t need = sizeof(CaptureRecord_t) + len;
+    if (base + need > CAPTURE_BUFFER_SIZE) {
+        captureArmed = false;
+    } else {
+        CaptureRecord_t record;
+        record.timestamp = esp_timer_get_time();
+        memcpy(record.mac, mac, 6);
+        record.len = len;
+        memcpy(captureBuffer + base, &record, sizeof(record));
+        memcpy(captureBuffer + base + sizeof(record), data, len);
+
+        // Publish, unless the capture was restarted meanwhile
+        __atomic_compare_exchange_n(&captureLength, &base, base + need, false,
+                                    __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&captureWriting, false, __ATOMIC_RELEASE);
+}
+
+const uint8_t* captureStop(uint32_t* length) {
+    if (captureDownloading) return NULL;
+    captureDisarm();
+    captureDownloading = true;
+    if (captureBuffer == NULL) {
+        // Never started: an empty capture
+        *length = CAPTURE_MAGIC_LEN;
+        return emptyCapture;
+    }
+    *length = __atomic_load_n(&captureLength, __ATOMIC_ACQUIRE);
+    return captureBuffer;
+}
+
+void captureRelease() {
+    captureDisarm();
+    free(captureBuffer);
+    captureBuffer = NULL;
+    captureLength = 0;
+    captureDownloading = false;
+}
+
+bool captureActive() {
+    return captureArmed;
+}
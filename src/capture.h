@@ -0,0 +1,30 @@
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+#include <Arduino.h>
+
+// ESP-NOW capture file, little-endian:
+//   8 bytes CAPTURE_MAGIC, then records of CaptureRecord_t + payload
+#define CAPTURE_MAGIC           "ENOWCAP1"
+#define CAPTURE_MAGIC_LEN       8
+#define CAPTURE_BUFFER_SIZE     32768   // heap while recording, about 600 frames
+
+struct __attribute__((packed)) CaptureRecord_t {
+    uint64_t timestamp;     // us since boot
+    uint8_t mac[6];         // sender
+    uint16_t len;           // payload bytes that follow
+};
+
+// Recorder, fed from the ESP-NOW callback. Recording stops when the buffer
+// is full or when it is read. The buffer is allocated on start and freed
+// once the capture has been downloaded.
+// Start, stop and release are called from the web server task only.
+// Returns false while a download is in flight or without memory.
+bool captureStart();
+void captureFrame(const uint8_t* mac, const uint8_t* data, int len);
+// Stops recording, returns the capture file in place, NULL while another
+// download is in flight. The file stays valid until captureRelease.
+const uint8_t* captureStop(uint32_t* length);
+// The download is done: frees the buffer
+void captureRelease();
+bool captureActive();
+#endif
@@ -3,6 +3,7 @@
 #include <Arduino.h>
 // 4E:52:A6:FB:23:EA my MAC
 const uint16_t UDP_PORT = 14550; // GCS UDP port
+const uint16_t TCP_PORT = 5760;  // GCS TCP port
 const char apSSID[] = "mavlink";
 const char apPassword[] = "12345678";
 typedef enum {
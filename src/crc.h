@@ -0,0 +1,7 @@
+#ifndef _CRC_H_
+#define _CRC_H_
+#include <Arduino.h>
+
+uint8_t crc8DvbS2(uint8_t crc, const uint8_t* data, int len);
+
+#endif
@@ -1,5 +1,6 @@
 ﻿#include <Arduino.h>
 #include "crsf.h"
+#include "crc.h"
 
 // CRSF Frame Types
 typedef enum {
@@ -77,47 +78,41 @@ int32_t bigEndian32(const uint8_t* bytes) {
     return (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
 }
 
+
 // ExpressLRS CRC checking
 uint8_t crsfCRC(const uint8_t* data, uint8_t len) {
-    uint8_t crc = 0;
-    for (uint8_t i = 0; i < len; i++) {
-        crc ^= data[i];
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc & 0x80) {
-                crc = (crc << 1) ^ 0xD5;
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    return crc;
+    return crc8DvbS2(0, data, len);
 }
 
-// Data parser
-bool parseCRSFPacket(const uint8_t *data, int len, TelemetryData_t* telemetry) {
-    // Fast checking
-    if (len < 11) return false;
-    if (data[0] != 0x24 || data[1] != 0x58 || data[2] != 0x3C) return false;
+// Marks a group as new for the scheduler and for the MAVLink encoder
+static inline void groupUpdated(TelemetryData_t* telemetry, int group) {
+    telemetry->updated |= 1 << group;
+    telemetry->dirty |= 1 << group;
+    telemetry->received[group] = telemetry->lastUpdate;
+}
 
-    // CRSF data start point
-    const uint8_t *crsfData = data + 8;
-    int crsfLen = len - 8;
+// Single CRSF frame parser: [address][length][type][payload][crc]
+static bool parseCRSFFrame(const uint8_t *crsfData, int crsfLen, TelemetryData_t* telemetry) {
     if (crsfLen < 4) return false;
 
     // read header
     uint8_t frame_len = crsfData[1];
     uint8_t frame_type = crsfData[2];
 
-    if (frame_len < 3 || frame_len > crsfLen) return false;
+    if (frame_len < 3 || frame_len + 2 > crsfLen) return false;
 
     uint8_t payload_len = frame_len - 2;
     const uint8_t* payload = crsfData + 3;
 
+    // CRC covers type and payload
+    if (crsfCRC(crsfData + 2, frame_len - 1) != crsfData[frame_len + 1]) {
+        telemetry->statistic.crcErrors++;
+        return false;
+    }
+
     // Statistic update
     telemetry->statistic.packetCount++;
-    if (frame_type < 256) {
-        telemetry->statistic.crsfPackets[frame_type]++;
-    }
+    telemetry->statistic.crsfPackets[frame_type]++;
     telemetry->lastUpdate = millis();
 
     // Data packets handle
@@ -126,6 +121,7 @@ bool parseCRSFPacket(const uint8_t *data, int len, TelemetryData_t* telemetry) {
         case CRSF_FRAMETYPE_GPS: // GPS
             if (payload_len >= 15) {
                 telemetry->gps.enabled = true;
+                groupUpdated(telemetry, TELEMETRY_GROUP_GPS);
                 telemetry->gps.latitude = bigEndian32(payload) / 10000000.0; // [degree]
                 telemetry->gps.longitude = bigEndian32(payload + 4) / 10000000.0; // [degree]
                 telemetry->gps.groundSpeed = bigEndian16(payload + 8) / 10.0f; // [m/s]
@@ -138,6 +134,7 @@ bool parseCRSFPacket(const uint8_t *data, int len, TelemetryData_t* telemetry) {
         case CRSF_FRAMETYPE_BATTERY_SENSOR: // Battery
             if (payload_len >= 8) {
                 telemetry->battery.enabled = true;
+                groupUpdated(telemetry, TELEMETRY_GROUP_BATTERY);
                 telemetry->battery.voltage = bigEndian16(payload) * 0.1f;
                 telemetry->battery.current = bigEndian16(payload + 2) * 0.1f;
                 telemetry->battery.capacity = bigEndian24(payload + 4);
@@ -148,6 +145,7 @@ bool parseCRSFPacket(const uint8_t *data, int len, TelemetryData_t* telemetry) {
         case CRSF_FRAMETYPE_ATTITUDE: // Attitude
             if (payload_len >= 6) {
                 telemetry->attitude.enabled = true;
+                groupUpdated(telemetry, TELEMETRY_GROUP_ATTITUDE);
                 telemetry->attitude.pitch = bigEndian16(payload) / 10000.0f; // rad*10000 → rad
                 telemetry->attitude.roll = bigEndian16(payload + 2) / 10000.0f; // rad*10000 → rad
                 telemetry->attitude.yaw = bigEndian16(payload + 4) / 10000.0f; // rad*10000 → rad
@@ -157,6 +155,7 @@ bool parseCRSFPacket(const uint8_t *data, int len, TelemetryData_t* telemetry) {
         case CRSF_FRAMETYPE_FLIGHT_MODE: // Flight Mode
             if (payload_len >= 1) {
                 telemetry->flightMode.enabled = true;
+                groupUpdated(telemetry, TELEMETRY_GROUP_FLIGHT_MODE);
                 int len = payload_len < 16 ? payload_len : 16;
                 memcpy(telemetry->flightMode.mode, payload, len);
                 telemetry->flightMode.mode[len] = '\0';
@@ -166,3 +165,19 @@ bool parseCRSFPacket(const uint8_t *data, int len, TelemetryData_t* telemetry) {
 
     return true;
 }
+
+// Data parser: walks every CRSF frame of the backpack MSP payload
+// Returns the count of decoded frames
+int parseCRSFPacket(const uint8_t *crsfData, int crsfLen, TelemetryData_t* telemetry) {
+    int frameCount = 0;
+
+    while (crsfLen >= 4) {
+        int frameSize = crsfData[1] + 2;
+        if (!parseCRSFFrame(crsfData, crsfLen, telemetry)) break;
+        frameCount++;
+        crsfData += frameSize;
+        crsfLen -= frameSize;
+    }
+
+    return frameCount;
+}
\ No newline at end of file
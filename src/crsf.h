@@ -2,6 +2,19 @@
 #define CRSF_H
 #include <Arduino.h>
 
+// Telemetry groups updated by the parser
+#define TELEMETRY_GROUP_GPS         0
+#define TELEMETRY_GROUP_BATTERY     1
+#define TELEMETRY_GROUP_ATTITUDE    2
+#define TELEMETRY_GROUP_FLIGHT_MODE 3
+#define TELEMETRY_GROUPS            4
+
+#define TELEMETRY_GPS           (1 << TELEMETRY_GROUP_GPS)
+#define TELEMETRY_BATTERY       (1 << TELEMETRY_GROUP_BATTERY)
+#define TELEMETRY_ATTITUDE      (1 << TELEMETRY_GROUP_ATTITUDE)
+#define TELEMETRY_FLIGHT_MODE   (1 << TELEMETRY_GROUP_FLIGHT_MODE)
+#define TELEMETRY_ALL           (TELEMETRY_GPS | TELEMETRY_BATTERY | TELEMETRY_ATTITUDE | TELEMETRY_FLIGHT_MODE)
+
 // Телеметрия
 struct TelemetryData_t {
     struct {
@@ -33,10 +46,14 @@ struct TelemetryData_t {
     struct {
         uint32_t packetCount;
         uint32_t crsfPackets[256];
+        uint32_t crcErrors;
     } statistic;
     unsigned long lastUpdate;
+    uint32_t updated;   // TELEMETRY_* groups decoded since the last emission
+    uint32_t dirty;     // TELEMETRY_* groups changed since the MAVLink encoder last saw them
+    unsigned long received[TELEMETRY_GROUPS];   // receive time of each group [ms]
 };
 
-bool parseCRSFPacket(const uint8_t *data, int len, TelemetryData_t* telemetry);
+int parseCRSFPacket(const uint8_t *crsfData, int crsfLen, TelemetryData_t* telemetry);
 #endif
 
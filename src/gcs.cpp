@@ -0,0 +1,57 @@
+#include "gcs.h"
+
+static GCSEndpoint_t endpoints[MAX_GCS_ENDPOINTS];
+static int endpointsUsed = 0;
+
+// Registers the sender of a GCS packet, replaces the oldest one if full
+int gcsEndpointSeen(const IPAddress& ip, uint16_t port, uint32_t now, bool* added) {
+    int slot = -1;
+
+    for (int i = 0; i < MAX_GCS_ENDPOINTS; i++) {
+        GCSEndpoint_t* endpoint = &endpoints[i];
+        if (!endpoint->used) {
+            if (slot < 0 || endpoints[slot].used) slot = i;
+            continue;
+        }
+        if (endpoint->ip == ip && endpoint->port == port) {
+            endpoint->lastSeen = now;
+            *added = false;
+            return i;
+        }
+        if (slot < 0 || (endpoints[slot].used && (int32_t)(endpoint->lastSeen - endpoints[slot].lastSeen) < 0)) {
+            slot = i;
+        }
+    }
+
+    GCSEndpoint_t* endpoint = &endpoints[slot];
+    if (!endpoint->used) {
+        endpointsUsed++;
+    }
+    endpoint->used = true;
+    endpoint->ip = ip;
+    endpoint->port = port;
+    endpoint->lastSeen = now;
+    *added = true;
+    return slot;
+}
+
+// Ages out the ground stations that went silent
+void gcsEndpointsExpire(uint32_t now) {
+    for (int i = 0; i < MAX_GCS_ENDPOINTS; i++) {
+        GCSEndpoint_t* endpoint = &endpoints[i];
+        if (endpoint->used && now - endpoint->lastSeen > GCS_ENDPOINT_TIMEOUT_MS) {
+            endpoint->used = false;
+            endpointsUsed--;
+        }
+    }
+}
+
+int gcsEndpointCount() {
+    return endpointsUsed;
+}
+
+// Walks the table slots, returns NULL for a free slot
+GCSEndpoint_t* gcsEndpointAt(int index) {
+    if (index < 0 || index >= MAX_GCS_ENDPOINTS || !endpoints[index].used) return NULL;
+    return &endpoints[index];
+}
@@ -0,0 +1,22 @@
+#ifndef _GCS_H_
+#define _GCS_H_
+#include <Arduino.h>
+#include <IPAddress.h>
+
+#define MAX_GCS_ENDPOINTS       4
+#define GCS_ENDPOINT_TIMEOUT_MS 5000    // forget a GCS silent for this time
+
+// Ground station learned from the packets it sends to us
+struct GCSEndpoint_t {
+    bool used;
+    IPAddress ip;
+    uint16_t port;
+    uint32_t lastSeen;
+};
+
+// Returns the endpoint index, added is set when the endpoint is new
+int gcsEndpointSeen(const IPAddress& ip, uint16_t port, uint32_t now, bool* added);
+void gcsEndpointsExpire(uint32_t now);
+int gcsEndpointCount();
+GCSEndpoint_t* gcsEndpointAt(int index);
+#endif
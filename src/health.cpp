@@ -0,0 +1,87 @@
+#include <esp_freertos_hooks.h>
+#include "health.h"
+#include "pipeline.h"
+
+BridgeHealth_t bridgeHealth;
+
+// Idle task loops per core. The hooks return false, so the idle task keeps
+// spinning and the count grows with the idle time. The fully idle rate is
+// measured once in healthInit, before the tasks start, and only raised later.
+static volatile uint32_t idleLoops[HEALTH_MAX_CORES];
+static uint32_t lastIdleLoops[HEALTH_MAX_CORES];
+static uint32_t idleRateMax[HEALTH_MAX_CORES];     // loops per second
+static uint16_t coreLoad[HEALTH_MAX_CORES];
+
+static uint32_t lastUpdate = 0;
+static uint32_t lastReceived = 0;
+static uint32_t lastDropped = 0;
+
+static bool IRAM_ATTR idleHookCore0() {
+    idleLoops[0]++;
+    return false;
+}
+
+static bool IRAM_ATTR idleHookCore1() {
+    idleLoops[1]++;
+    return false;
+}
+
+void healthInit() {
+    esp_register_freertos_idle_hook_for_cpu(idleHookCore0, 0);
+    if (portNUM_PROCESSORS > 1) {
+        esp_register_freertos_idle_hook_for_cpu(idleHookCore1, 1);
+    }
+
+    // Calibration: the caller blocks here and nothing else runs yet
+    uint32_t start[HEALTH_MAX_CORES];
+    for (int core = 0; core < HEALTH_MAX_CORES; core++) {
+        start[core] = idleLoops[core];
+    }
+    uint32_t begin = millis();
+    delay(HEALTH_CALIBRATION_MS);
+    uint32_t elapsed = millis() - begin;
+    for (int core = 0; core < HEALTH_MAX_CORES; core++) {
+        lastIdleLoops[core] = idleLoops[core];
+        idleRateMax[core] = elapsed ? (uint64_t)(lastIdleLoops[core] - start[core]) * 1000 / elapsed : 0;
+    }
+    lastUpdate = millis();
+}
+
+static inline uint16_t saturate16(uint32_t value) {
+    return value > 0xFFFF ? 0xFFFF : value;
+}
+
+void healthUpdate(uint32_t now) {
+    uint32_t elapsed = now - lastUpdate;
+    if (elapsed < HEALTH_PERIOD_MS) return;
+    lastUpdate = now;
+
+    uint16_t load = 0;
+    for (int core = 0; core < HEALTH_MAX_CORES; core++) {
+        uint32_t loops = idleLoops[core];
+        uint32_t rate = (uint64_t)(loops - lastIdleLoops[core]) * 1000 / elapsed;
+        lastIdleLoops[core] = loops;
+        if (rate > idleRateMax[core]) {
+            idleRateMax[core] = rate;
+        }
+        coreLoad[core] = idleRateMax[core] ? 1000 - (uint64_t)rate * 1000 / idleRateMax[core] : 0;
+        if (coreLoad[core] > load) load = coreLoad[core];
+    }
+
+    // Counters of the ingest path, each one written by a single task
+    uint32_t received = receivedPackets;
+    uint32_t dropped = packetBuffer.overflowCount + timedOutPackets;
+    uint32_t frames = received - lastReceived;
+    uint32_t lost = dropped - lastDropped;
+    lastReceived = received;
+    lastDropped = dropped;
+
+    bridgeHealth.load = load;
+    uint32_t dropRate = frames ? (uint64_t)lost * 10000 / frames : 0;
+    bridgeHealth.dropRate = dropRate > 10000 ? 10000 : dropRate;   // timeouts lag a period
+    bridgeHealth.errors = saturate16(rejectedPackets);
+}
+
+uint16_t healthCoreLoad(int core) {
+    return coreLoad[core];
+}
@@ -0,0 +1,25 @@
+#ifndef _HEALTH_H_
+#define _HEALTH_H_
+#include <Arduino.h>
+
+// Bridge health reported to the GCS in SYS_STATUS
+#define HEALTH_PERIOD_MS    1000
+#define HEALTH_MAX_CORES    2
+#define HEALTH_CALIBRATION_MS   200     // idle time measured at startup
+
+struct BridgeHealth_t {
+    uint16_t load;          // busiest core, 0.1 %
+    uint16_t dropRate;      // frames lost in the last period, 0.01 %
+    uint16_t errors;        // frames rejected since boot, saturated
+};
+
+extern BridgeHealth_t bridgeHealth;
+
+// Registers the idle hooks measuring the CPU load and calibrates them.
+// Blocks for HEALTH_CALIBRATION_MS, call it before the tasks are created.
+void healthInit();
+// Recomputes bridgeHealth once per period, from the processing task
+void healthUpdate(uint32_t now);
+// Load of one core, 0.1 %
+uint16_t healthCoreLoad(int core);
+#endif
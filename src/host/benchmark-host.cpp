@@ -0,0 +1,7 @@
+// Host entry of the benchmark, see benchmark.h
+#include "benchmark.h"
+
+int main() {
+    benchmarkRun();
+    return 0;
+}
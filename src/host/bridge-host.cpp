@@ -0,0 +1,172 @@
+// Host driver: replays recorded ESP-NOW frames through the real pipeline and
+// writes the produced MAVLink bytes to a file or to a UDP socket.
+// Inputs are read by capture-reader: firmware captures, pcap or text.
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include "pipeline.h"
+#include "vehicles.h"
+#include "capture-reader.h"
+#include "trace.h"
+
+#define HOST_POLL_INTERVAL_MS   20      // as GCS_POLL_INTERVAL_MS on the ESP32
+
+static FILE* outputFile = NULL;
+static int outputSocket = -1;
+static struct sockaddr_in outputAddress;
+
+static void sendDatagram(const uint8_t* data, uint16_t length) {
+    if (outputFile != NULL) {
+        fwrite(data, 1, length, outputFile);
+    }
+    if (outputSocket >= 0) {
+        sendto(outputSocket, data, length, 0, (struct sockaddr*)&outputAddress, sizeof(outputAddress));
+    }
+}
+
+static uint64_t wallClockUs() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+}
+
+// Runs the scheduled wakeups of the processing task up to the given time
+static void runUntil(uint64_t untilUs) {
+    for (;;) {
+        uint32_t wait = pipelineNextWakeup(HOST_POLL_INTERVAL_MS);
+        uint64_t wake = hostClockNow() + (uint64_t)(wait ? wait : 1) * 1000;
+        if (wake > untilUs) break;
+        hostClockSet(wake);
+        pipelineSendScheduled();
+    }
+    hostClockSet(untilUs);
+}
+
+static void usage() {
+    fprintf(stderr, "usage: bridge-host <input> [-o <mavlink file>] [-u <host>:<port>] [-s <speed>] [-l]\n"
+                    "  input: firmware capture, pcap of ESP-NOW action frames or text lines\n"
+                    "  speed: 1 original, N times faster, 0 as fast as possible (default)\n"
+                    "  -l: print the latency histograms of the frame stages\n");
+}
+
+int main(int argc, char** argv) {
+    const char* inputPath = NULL;
+    double speed = 0;
+    bool latency = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            outputFile = fopen(argv[++i], "wb");
+            if (outputFile == NULL) {
+                perror(argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc) {
+            char host[64];
+            unsigned int port;
+            if (sscanf(argv[++i], "%63[^:]:%u", host, &port) != 2) {
+                usage();
+                return 1;
+            }
+            outputSocket = socket(AF_INET, SOCK_DGRAM, 0);
+            memset(&outputAddress, 0, sizeof(outputAddress));
+            outputAddress.sin_family = AF_INET;
+            outputAddress.sin_port = htons(port);
+            if (outputSocket < 0 || inet_pton(AF_INET, host, &outputAddress.sin_addr) != 1) {
+                fprintf(stderr, "bad UDP target %s\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            speed = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-l") == 0) {
+            latency = true;
+        } else if (inputPath == NULL && (argv[i][0] != '-' || argv[i][1] == 0)) {
+            inputPath = argv[i];
+        } else {
+            usage();
+            return 1;
+        }
+    }
+    if (inputPath == NULL) {
+        usage();
+        return 1;
+    }
+
+    CaptureReader_t reader;
+    if (!captureOpen(&reader, inputPath)) {
+        fprintf(stderr, "%s: can not read\n", inputPath);
+        return 1;
+    }
+
+    pipelineInit(sendDatagram);
+
+    static CaptureFrame_t frame;
+    uint32_t frames = 0;
+    uint32_t dropped = 0;
+    uint64_t firstTimestamp = 0;
+    uint64_t wallStart = wallClockUs();
+    uint64_t busyUs = 0;
+
+    while (captureNext(&reader, &frame)) {
+        if (frames == 0) {
+            firstTimestamp = frame.timestamp;
+            hostClockSet(frame.timestamp);
+        }
+        if (frame.timestamp < hostClockNow()) {
+            frame.timestamp = hostClockNow();   // out of order capture
+        }
+
+        // Original or scaled pace on the wall clock
+        if (speed > 0) {
+            uint64_t due = wallStart + (uint64_t)((frame.timestamp - firstTimestamp) / speed);
+            uint64_t now = wallClockUs();
+            if (due > now) usleep(due - now);
+        }
+
+        uint64_t start = wallClockUs();
+        runUntil(frame.timestamp);
+
+        // One processing task wakeup per received frame
+        frames++;
+        if (!pipelinePush(frame.mac, frame.payload, frame.len)) {
+            dropped++;
+        }
+        pipelineDrain();
+        pipelineSendScheduled();
+        busyUs += wallClockUs() - start;
+    }
+
+    // Let the last scheduled messages go out
+    if (frames > 0) {
+        runUntil(hostClockNow() + 1000000);
+    }
+    batcherFlush(&udpBatcher);
+
+    fprintf(stderr, "%s frames:%lu dropped:%lu rejected:%lu vehicles:%d datagrams:%lu bytes:%lu\n",
+            captureFormatName(reader.format), (unsigned long)frames, (unsigned long)dropped,
+            (unsigned long)rejectedPackets, vehicleCount(),
+            (unsigned long)udpBatcher.datagrams, (unsigned long)udpBatcher.bytes);
+    if (frames > 0 && busyUs > 0) {
+        // At full speed this is the throughput over real traffic
+        fprintf(stderr, "pipeline: %.0f ns/frame, %.0f frames/s\n",
+                busyUs * 1000.0 / frames, frames * 1000000.0 / busyUs);
+    }
+
+    if (latency) {
+        // Virtual time: only the waits of the schedule and the batcher show up
+        TraceReport_t report;
+        char line[256];
+        traceReportBegin(&report);
+        int length;
+        while ((length = traceReportLine(&report, line, sizeof(line))) > 0) {
+            fwrite(line, 1, length, stderr);
+        }
+    }
+
+    captureClose(&reader);
+    if (outputFile != NULL) fclose(outputFile);
+    if (outputSocket >= 0) close(outputSocket);
+    return 0;
+}
@@ -0,0 +1,200 @@
+#include "capture-reader.h"
+#include "capture.h"
+
+#define PCAP_MAGIC              0xA1B2C3D4
+#define PCAP_MAGIC_NS           0xA1B23C4D
+#define LINKTYPE_IEEE802_11     105
+#define LINKTYPE_RADIOTAP       127
+#define PCAP_SNAPLEN_MAX        4096
+#define TEXT_LINE_MAX           1024
+
+// ESP-NOW in an 802.11 action frame: category 127 (vendor), Espressif OUI,
+// 4 random bytes, then the vendor element: 0xDD len OUI type 4 version body
+#define WIFI_HEADER_LEN         24
+#define ESPNOW_ELEMENT_OFFSET   8
+#define ESPNOW_ELEMENT_ID       0xDD
+#define ESPNOW_TYPE             0x04
+static const uint8_t espressifOUI[3] = { 0x18, 0xFE, 0x34 };
+
+static uint32_t swap32(uint32_t value) {
+    return __builtin_bswap32(value);
+}
+
+bool captureOpen(CaptureReader_t* reader, const char* path) {
+    memset(reader, 0, sizeof(CaptureReader_t));
+    reader->file = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (reader->file == NULL) return false;
+
+    uint8_t head[CAPTURE_MAGIC_LEN];
+    size_t got = fread(head, 1, sizeof(head), reader->file);
+
+    if (got == CAPTURE_MAGIC_LEN && memcmp(head, CAPTURE_MAGIC, CAPTURE_MAGIC_LEN) == 0) {
+        reader->format = CAPTURE_FORMAT_FIRMWARE;
+        return true;
+    }
+
+    uint32_t magic;
+    memcpy(&magic, head, 4);
+    if (got >= 4 && (magic == PCAP_MAGIC || magic == PCAP_MAGIC_NS ||
+                     swap32(magic) == PCAP_MAGIC || swap32(magic) == PCAP_MAGIC_NS)) {
+        // Global header: magic, version, zone, sigfigs, snaplen, linktype
+        uint8_t rest[16];
+        if (got != CAPTURE_MAGIC_LEN || fread(rest, 1, sizeof(rest), reader->file) != sizeof(rest)) return false;
+        reader->format = CAPTURE_FORMAT_PCAP;
+        reader->swapped = magic != PCAP_MAGIC && magic != PCAP_MAGIC_NS;
+        uint32_t native = reader->swapped ? swap32(magic) : magic;
+        reader->nanoseconds = native == PCAP_MAGIC_NS;
+        memcpy(&reader->linkType, rest + 12, 4);
+        if (reader->swapped) reader->linkType = swap32(reader->linkType);
+        return reader->linkType == LINKTYPE_IEEE802_11 || reader->linkType == LINKTYPE_RADIOTAP;
+    }
+
+    // Text: start over
+    if (reader->file == stdin) {
+        for (int i = (int)got - 1; i >= 0; i--) ungetc(head[i], stdin);
+    } else {
+        rewind(reader->file);
+    }
+    reader->format = CAPTURE_FORMAT_TEXT;
+    return true;
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static bool nextText(CaptureReader_t* reader, CaptureFrame_t* frame) {
+    char line[TEXT_LINE_MAX];
+
+    while (fgets(line, sizeof(line), reader->file)) {
+        char* comment = strchr(line, '#');
+        if (comment) *comment = 0;
+
+        unsigned long long time;
+        unsigned int m[6];
+        int consumed = 0;
+        if (sscanf(line, "%llu %x:%x:%x:%x:%x:%x %n", &time, &m[0], &m[1], &m[2], &m[3], &m[4], &m[5], &consumed) != 7) {
+            continue;
+        }
+        frame->timestamp = time;
+        for (int i = 0; i < 6; i++) frame->mac[i] = m[i];
+
+        frame->len = 0;
+        for (char* p = line + consumed; p[0] && p[1] && frame->len < MAX_ESPNOW_PAYLOAD; ) {
+            int high = hexValue(p[0]);
+            int low = hexValue(p[1]);
+            if (high < 0 || low < 0) {
+                p++;    // separators are allowed
+                continue;
+            }
+            frame->payload[frame->len++] = (high << 4) | low;
+            p += 2;
+        }
+        return true;
+    }
+    return false;
+}
+
+static bool nextFirmware(CaptureReader_t* reader, CaptureFrame_t* frame) {
+    for (;;) {
+        CaptureRecord_t record;
+        if (fread(&record, 1, sizeof(record), reader->file) != sizeof(record)) return false;
+
+        uint8_t discard[256];
+        if (record.len > MAX_ESPNOW_PAYLOAD) {
+            // Not something the bridge would accept, skip it
+            for (int left = record.len; left > 0; ) {
+                int chunk = left < (int)sizeof(discard) ? left : (int)sizeof(discard);
+                if (fread(discard, 1, chunk, reader->file) != (size_t)chunk) return false;
+                left -= chunk;
+            }
+            continue;
+        }
+        if (fread(frame->payload, 1, record.len, reader->file) != record.len) return false;
+
+        frame->timestamp = record.timestamp;
+        memcpy(frame->mac, record.mac, 6);
+        frame->len = record.len;
+        return true;
+    }
+}
+
+// Finds the ESP-NOW body in one captured 802.11 frame
+static bool decodeWifiFrame(const CaptureReader_t* reader, const uint8_t* data, uint32_t len, CaptureFrame_t* frame) {
+    if (reader->linkType == LINKTYPE_RADIOTAP) {
+        if (len < 4) return false;
+        uint16_t radiotapLen = data[2] | (data[3] << 8);
+        if (radiotapLen > len) return false;
+        data += radiotapLen;
+        len -= radiotapLen;
+    }
+
+    // Management frame, subtype action
+    if (len < WIFI_HEADER_LEN + ESPNOW_ELEMENT_OFFSET + 7 || data[0] != 0xD0) return false;
+    const uint8_t* body = data + WIFI_HEADER_LEN;
+    uint32_t bodyLen = len - WIFI_HEADER_LEN;
+
+    if (body[0] != 0x7F || memcmp(body + 1, espressifOUI, 3) != 0) return false;
+
+    const uint8_t* element = body + ESPNOW_ELEMENT_OFFSET;
+    uint8_t elementLen = element[1];
+    if (element[0] != ESPNOW_ELEMENT_ID || memcmp(element + 2, espressifOUI, 3) != 0 ||
+        element[5] != ESPNOW_TYPE || elementLen < 5) return false;
+
+    int payloadLen = elementLen - 5;
+    if ((uint32_t)(ESPNOW_ELEMENT_OFFSET + 2 + elementLen) > bodyLen || payloadLen > MAX_ESPNOW_PAYLOAD) return false;
+
+    memcpy(frame->mac, data + 10, 6);   // transmitter address
+    memcpy(frame->payload, element + 7, payloadLen);
+    frame->len = payloadLen;
+    return true;
+}
+
+static bool nextPcap(CaptureReader_t* reader, CaptureFrame_t* frame) {
+    static uint8_t packet[PCAP_SNAPLEN_MAX];
+
+    for (;;) {
+        // Record header: seconds, fraction, captured length, original length
+        uint32_t header[4];
+        if (fread(header, 1, sizeof(header), reader->file) != sizeof(header)) return false;
+        if (reader->swapped) {
+            for (int i = 0; i < 4; i++) header[i] = swap32(header[i]);
+        }
+
+        uint32_t captured = header[2];
+        uint32_t keep = captured < sizeof(packet) ? captured : sizeof(packet);
+        if (fread(packet, 1, keep, reader->file) != keep) return false;
+        if (captured > keep && fseek(reader->file, captured - keep, SEEK_CUR) != 0) return false;
+
+        if (decodeWifiFrame(reader, packet, keep, frame)) {
+            frame->timestamp = (uint64_t)header[0] * 1000000 + (reader->nanoseconds ? header[1] / 1000 : header[1]);
+            return true;
+        }
+    }
+}
+
+bool captureNext(CaptureReader_t* reader, CaptureFrame_t* frame) {
+    switch (reader->format) {
+        case CAPTURE_FORMAT_FIRMWARE: return nextFirmware(reader, frame);
+        case CAPTURE_FORMAT_PCAP: return nextPcap(reader, frame);
+        default: return nextText(reader, frame);
+    }
+}
+
+void captureClose(CaptureReader_t* reader) {
+    if (reader->file != NULL && reader->file != stdin) {
+        fclose(reader->file);
+    }
+    reader->file = NULL;
+}
+
+const char* captureFormatName(CaptureFormat_e format) {
+    switch (format) {
+        case CAPTURE_FORMAT_FIRMWARE: return "capture";
+        case CAPTURE_FORMAT_PCAP: return "pcap";
+        default: return "text";
+    }
+}
@@ -0,0 +1,35 @@
+#ifndef _CAPTURE_READER_H_
+#define _CAPTURE_READER_H_
+#include <Arduino.h>
+#include "pipeline.h"
+
+// Reads ESP-NOW frames from a firmware capture (capture.h), from a pcap of
+// 802.11 vendor action frames (with or without radiotap) or from text lines
+//   <time us> <sender MAC aa:bb:cc:dd:ee:ff> <payload hex>
+enum CaptureFormat_e {
+    CAPTURE_FORMAT_TEXT,
+    CAPTURE_FORMAT_FIRMWARE,
+    CAPTURE_FORMAT_PCAP,
+};
+
+struct CaptureReader_t {
+    FILE* file;
+    CaptureFormat_e format;
+    bool swapped;           // pcap written with the other byte order
+    bool nanoseconds;       // pcap timestamps in ns
+    uint32_t linkType;
+};
+
+struct CaptureFrame_t {
+    uint64_t timestamp;     // us
+    uint8_t mac[6];
+    int len;
+    uint8_t payload[MAX_ESPNOW_PAYLOAD];
+};
+
+bool captureOpen(CaptureReader_t* reader, const char* path);
+// Returns false at the end of the input
+bool captureNext(CaptureReader_t* reader, CaptureFrame_t* frame);
+void captureClose(CaptureReader_t* reader);
+const char* captureFormatName(CaptureFormat_e format);
+#endif
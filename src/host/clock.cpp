@@ -0,0 +1,35 @@
+#include <Arduino.h>
+#include <esp_freertos_hooks.h>
+
+// Time only moves when the driver says so, runs are repeatable
+static uint64_t clockUs = 0;
+
+void hostClockSet(uint64_t us) {
+    if (us > clockUs) clockUs = us;
+}
+
+uint64_t hostClockNow() {
+    return clockUs;
+}
+
+unsigned long millis() {
+    return (uint32_t)(clockUs / 1000);    // wraps like on the ESP32
+}
+
+unsigned long micros() {
+    return (uint32_t)clockUs;
+}
+
+esp_freertos_idle_cb_t hostIdleHooks[portNUM_PROCESSORS];
+uint32_t hostIdleLoopsPerMs = 0;
+
+// The caller blocks, so every core is idle meanwhile
+void delay(unsigned long ms) {
+    for (int cpu = 0; cpu < portNUM_PROCESSORS; cpu++) {
+        if (hostIdleHooks[cpu] == NULL) continue;
+        for (uint32_t i = 0; i < ms * hostIdleLoopsPerMs; i++) {
+            hostIdleHooks[cpu]();
+        }
+    }
+    hostClockSet(clockUs + ms * 1000);
+}
@@ -0,0 +1,22 @@
+#ifndef _HOST_ARDUINO_H_
+#define _HOST_ARDUINO_H_
+// Just enough of the Arduino core to build the bridge pipeline on a PC
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PROGMEM
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// Virtual clock of the host build, moved by the driver
+void hostClockSet(uint64_t us);
+uint64_t hostClockNow();
+#endif
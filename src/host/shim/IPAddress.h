@@ -0,0 +1,19 @@
+#ifndef _HOST_IPADDRESS_H_
+#define _HOST_IPADDRESS_H_
+#include <Arduino.h>
+
+class IPAddress {
+public:
+    IPAddress() : address(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+        : address(a | (b << 8) | (c << 16) | ((uint32_t)d << 24)) {}
+    explicit IPAddress(uint32_t value) : address(value) {}
+
+    bool operator==(const IPAddress& other) const { return address == other.address; }
+    uint8_t operator[](int index) const { return (address >> (index * 8)) & 0xFF; }
+    operator uint32_t() const { return address; }
+
+private:
+    uint32_t address;   // network order, as on the ESP32
+};
+#endif
@@ -0,0 +1,19 @@
+#ifndef _HOST_ESP_FREERTOS_HOOKS_H_
+#define _HOST_ESP_FREERTOS_HOOKS_H_
+#include <Arduino.h>
+
+// No idle task on the host: the hooks only run when the driver calls them,
+// otherwise the load stays 0
+#define portNUM_PROCESSORS 2
+
+typedef bool (*esp_freertos_idle_cb_t)();
+
+extern esp_freertos_idle_cb_t hostIdleHooks[portNUM_PROCESSORS];
+// Idle loops run per core and millisecond of delay(), 0 by default
+extern uint32_t hostIdleLoopsPerMs;
+
+static inline int esp_register_freertos_idle_hook_for_cpu(esp_freertos_idle_cb_t hook, unsigned int cpu) {
+    hostIdleHooks[cpu] = hook;
+    return 0;
+}
+#endif
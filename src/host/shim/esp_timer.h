@@ -0,0 +1,9 @@
+#ifndef _HOST_ESP_TIMER_H_
+#define _HOST_ESP_TIMER_H_
+#include <Arduino.h>
+
+// The 64-bit boot time of the ESP-IDF, on the virtual clock
+static inline int64_t esp_timer_get_time() {
+    return (int64_t)hostClockNow();
+}
+#endif
@@ -0,0 +1,66 @@
+// MAVLink CRC16-MCRF4XX: the lookup table (and slice-by-4 when
+// MAVLINK_CRC_SLICE_BY_4 is defined) against the reference shift-xor code
+#include "test-host.h"
+#include "common/mavlink.h"
+
+#define TEST_BUFFERS        10000
+#define TEST_BUFFER_MAX     300
+
+// crc_accumulate of checksum.h without MAVLINK_CRC_TABLE
+static void crcReference(uint8_t data, uint16_t* crcAccum) {
+    uint8_t tmp = data ^ (uint8_t)(*crcAccum & 0xff);
+    tmp ^= (tmp << 4);
+    *crcAccum = (*crcAccum >> 8) ^ (tmp << 8) ^ (tmp << 3) ^ (tmp >> 4);
+}
+
+int testCrc16() {
+    int failures = 0;
+
+    // Every state with every byte
+    for (uint32_t state = 0; state <= 0xFFFF; state++) {
+        for (uint32_t data = 0; data <= 0xFF; data++) {
+            uint16_t expected = state;
+            uint16_t actual = state;
+            crcReference(data, &expected);
+            crc_accumulate(data, &actual);
+            if (actual != expected && failures++ < 10) {
+                printf("crc16 accumulate: state %04lX byte %02lX: %04X, expected %04X\n",
+                       (unsigned long)state, (unsigned long)data, actual, expected);
+            }
+        }
+    }
+
+    // Buffers of every length and alignment
+    static uint8_t buffer[TEST_BUFFER_MAX + 4];
+    for (int i = 0; i < TEST_BUFFERS; i++) {
+        int offset = testRandom() & 3;
+        int length = testRandom() % (TEST_BUFFER_MAX + 1);
+        uint16_t start = testRandom();
+        for (int j = 0; j < length; j++) {
+            buffer[offset + j] = testRandom();
+        }
+
+        uint16_t expected = X25_INIT_CRC;
+        uint16_t continued = start;
+        for (int j = 0; j < length; j++) {
+            crcReference(buffer[offset + j], &expected);
+            crcReference(buffer[offset + j], &continued);
+        }
+
+        uint16_t calculated = crc_calculate(buffer + offset, length);
+        uint16_t accumulated = start;
+        crc_accumulate_buffer(&accumulated, (const char*)buffer + offset, length);
+        if ((calculated != expected || accumulated != continued) && failures++ < 10) {
+            printf("crc16 buffer: %d bytes at +%d: %04X/%04X, expected %04X/%04X\n",
+                   length, offset, calculated, accumulated, expected, continued);
+        }
+    }
+
+#ifdef MAVLINK_CRC_SLICE_BY_4
+    const char* variant = "slice-by-4";
+#else
+    const char* variant = "table";
+#endif
+    printf("crc16 %s: 65536x256 states, %d buffers, %d failure(s)\n", variant, TEST_BUFFERS, failures);
+    return failures;
+}
@@ -0,0 +1,47 @@
+// CPU load of SYS_STATUS: the idle hooks are run by hand, core 1 busy with
+// traffic from the first period on, core 0 idle
+#include "test-host.h"
+#include <esp_freertos_hooks.h>
+#include "health.h"
+
+#define TEST_IDLE_LOOPS_PER_MS  100
+#define TEST_PERIODS            5
+
+static void runIdle(int core, uint32_t loops) {
+    for (uint32_t i = 0; i < loops; i++) {
+        hostIdleHooks[core]();
+    }
+}
+
+int testHealth() {
+    int failures = 0;
+
+    // Fully idle while healthInit calibrates
+    hostIdleLoopsPerMs = TEST_IDLE_LOOPS_PER_MS;
+    healthInit();
+    hostIdleLoopsPerMs = 0;
+    if (hostIdleHooks[0] == NULL || hostIdleHooks[1] == NULL) {
+        printf("health: idle hooks not registered\n");
+        return 1;
+    }
+
+    // Core 1 idle 40 % of each period, that is 60 % load
+    uint32_t idle = TEST_IDLE_LOOPS_PER_MS * HEALTH_PERIOD_MS;
+    for (int period = 0; period < TEST_PERIODS; period++) {
+        runIdle(0, idle);
+        runIdle(1, idle * 4 / 10);
+        hostClockSet(hostClockNow() + HEALTH_PERIOD_MS * 1000);
+        healthUpdate(millis());
+
+        uint16_t load0 = healthCoreLoad(0);
+        uint16_t load1 = healthCoreLoad(1);
+        if (load1 < 590 || load1 > 610 || load0 > 10 || bridgeHealth.load != load1) {
+            printf("health: period %d: load %u/%u, reported %u, expected 0/600\n",
+                   period, load0, load1, bridgeHealth.load);
+            failures++;
+        }
+    }
+
+    printf("health load: %d periods, %d failure(s)\n", TEST_PERIODS, failures);
+    return failures;
+}
@@ -0,0 +1,19 @@
+// Host entry of the self-tests: exits with 1 if any check failed
+#include "test-host.h"
+
+static uint32_t randomState = 12345;
+
+uint32_t testRandom() {
+    randomState = randomState * 1664525u + 1013904223u;
+    return randomState >> 8;
+}
+
+int main() {
+    int failures = 0;
+    failures += testMavlinkWire();
+    failures += testCrc16();
+    failures += testHealth();
+
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
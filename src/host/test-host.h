@@ -0,0 +1,12 @@
+#ifndef _TEST_HOST_H_
+#define _TEST_HOST_H_
+#include <Arduino.h>
+
+// Host self-tests, each one returns its failure count
+int testMavlinkWire();
+int testCrc16();
+int testHealth();
+
+// Deterministic random source shared by the tests
+uint32_t testRandom();
+#endif
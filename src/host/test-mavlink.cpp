@@ -0,0 +1,108 @@
+// Golden test of the direct-to-wire MAVLink writer: every message of
+// buildMAVLinkDataStream must be byte for byte what the generated
+// mavlink_msg_*_pack + mavlink_msg_to_send_buffer produce
+#include "test-host.h"
+#include "crsf.h"
+#include "mavlink.h"
+#include "scheduler.h"
+#include "vehicles.h"
+#include "health.h"
+#include "mavlink-reference.h"
+
+#define TEST_ROUNDS     5000
+
+static float randomFloat(float min, float max) {
+    return min + (max - min) * (testRandom() & 0xFFFF) / 65535.0f;
+}
+
+static void randomTelemetry(TelemetryData_t* telemetry) {
+    static const char* const modes[] = { "ACRO", "ANGL*", "HOR!", "WAIT?", "" };
+
+    memset(telemetry, 0, sizeof(TelemetryData_t));
+    telemetry->gps.enabled = testRandom() & 1;
+    telemetry->gps.latitude = randomFloat(-90, 90);
+    telemetry->gps.longitude = randomFloat(-180, 180);
+    telemetry->gps.altitude = randomFloat(-1000, 5000);
+    telemetry->gps.groundSpeed = randomFloat(0, 600);
+    telemetry->gps.heading = randomFloat(0, 359.99f);
+    telemetry->gps.satellites = testRandom() % 30;
+    telemetry->battery.enabled = testRandom() & 1;
+    telemetry->battery.voltage = randomFloat(0, 60);
+    telemetry->battery.current = randomFloat(0, 300);
+    telemetry->battery.remaining = testRandom() % 101;
+    telemetry->attitude.enabled = testRandom() & 1;
+    telemetry->attitude.pitch = randomFloat(-3.1416f, 3.1416f);
+    telemetry->attitude.roll = randomFloat(-3.1416f, 3.1416f);
+    telemetry->attitude.yaw = randomFloat(-3.1416f, 3.1416f);
+    telemetry->flightMode.enabled = testRandom() & 1;
+    strcpy(telemetry->flightMode.mode, modes[testRandom() % 5]);
+    telemetry->statistic.crcErrors = testRandom() % 70000;
+    for (int group = 0; group < TELEMETRY_GROUPS; group++) {
+        telemetry->received[group] = testRandom() << 8 | (testRandom() & 0xFF);
+    }
+    telemetry->dirty = TELEMETRY_ALL;
+}
+
+// Messages the stream must contain, in the order they are written
+static int expectedMessages(const TelemetryData_t* t, uint32_t messages, uint32_t* ids) {
+    int count = 0;
+    if ((messages & SCHEDULED_BIT(SCHEDULED_GPS_RAW_INT)) && t->gps.enabled) ids[count++] = MAVLINK_MSG_ID_GPS_RAW_INT;
+    if ((messages & SCHEDULED_BIT(SCHEDULED_GLOBAL_POSITION_INT)) && t->gps.enabled) ids[count++] = MAVLINK_MSG_ID_GLOBAL_POSITION_INT;
+    if ((messages & SCHEDULED_BIT(SCHEDULED_ATTITUDE)) && t->attitude.enabled) ids[count++] = MAVLINK_MSG_ID_ATTITUDE;
+    if (messages & SCHEDULED_BIT(SCHEDULED_HEARTBEAT)) ids[count++] = MAVLINK_MSG_ID_HEARTBEAT;
+    if (messages & SCHEDULED_BIT(SCHEDULED_SYS_STATUS)) ids[count++] = MAVLINK_MSG_ID_SYS_STATUS;
+    return count;
+}
+
+static int checkStream(const TelemetryData_t* telemetry, uint8_t systemId, uint32_t messages,
+                       const uint8_t* stream, uint16_t length, const char* path) {
+    uint32_t ids[SCHEDULED_MESSAGES];
+    int count = expectedMessages(telemetry, messages, ids);
+    uint16_t offset = 0;
+
+    for (int i = 0; i < count; i++) {
+        uint8_t reference[MAVLINK_MAX_PACKET_LEN];
+        const uint8_t* message = stream + offset;
+        if (offset + MAVLINK_NUM_NON_PAYLOAD_BYTES > length) {
+            printf("mavlink %s: message %lu missing\n", path, (unsigned long)ids[i]);
+            return 1;
+        }
+        uint16_t size = mavlinkWriteReference(telemetry, systemId, ids[i], message[4], reference);
+        if (offset + size > length || memcmp(message, reference, size) != 0) {
+            printf("mavlink %s: message %lu of system %d differs\n", path, (unsigned long)ids[i], systemId);
+            return 1;
+        }
+        offset += size;
+    }
+    if (offset != length) {
+        printf("mavlink %s: %d extra bytes\n", path, length - offset);
+        return 1;
+    }
+    return 0;
+}
+
+int testMavlinkWire() {
+    static TelemetryData_t telemetry;
+    uint8_t stream[512];
+    int failures = 0;
+
+    for (int round = 0; round < TEST_ROUNDS && failures < 10; round++) {
+        randomTelemetry(&telemetry);
+        bridgeHealth.load = testRandom() % 1001;
+        bridgeHealth.dropRate = testRandom() % 10001;
+        bridgeHealth.errors = testRandom() & 0xFFFF;
+
+        // System IDs past MAX_VEHICLES are not cached
+        uint8_t systemId = 1 + testRandom() % (MAX_VEHICLES + 2);
+        uint32_t messages = testRandom() & ((1u << SCHEDULED_MESSAGES) - 1);
+
+        // Fresh encoding, then the cached copy with a new sequence and CRC
+        uint16_t length = buildMAVLinkDataStream(&telemetry, systemId, messages, stream);
+        failures += checkStream(&telemetry, systemId, messages, stream, length, "encoded");
+        length = buildMAVLinkDataStream(&telemetry, systemId, messages, stream);
+        failures += checkStream(&telemetry, systemId, messages, stream, length, "cached");
+    }
+
+    printf("mavlink wire: %d rounds, %d failure(s)\n", TEST_ROUNDS, failures);
+    return failures;
+}
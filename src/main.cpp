@@ -5,7 +5,6 @@
 
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
-#include <freertos/queue.h>
 
 #include <WiFiUdp.h>
 #include <string.h>
@@ -13,8 +12,19 @@
 #include "web-server.h"
 
 #include "crsf.h"
+#include "msp.h"
 #include "mavlink.h"
 #include "config.h"
+#include "vehicles.h"
+#include "gcs.h"
+#include "pipeline.h"
+#include "tcp-server.h"
+#include "capture.h"
+#include "trace.h"
+#include "health.h"
+#ifdef BENCHMARK_ON_TARGET
+#include "benchmark.h"
+#endif
 //#define DEBUG_TO_LOG
 
 #ifndef LED_BUILTIN
@@ -22,31 +32,30 @@
 #endif
 
 // Config
-#define QUEUE_SIZE 20
-#define PACKET_TIMEOUT_MS 200
 #define TELEMETRY_TIMEOUT_MS 3000
-#define UDP_DATA_SEND_INTERVAL_MS   100
+#define GCS_POLL_INTERVAL_MS 20
 
 #define ESPNOW_CHANNEL 1
 
 // UDP setup
 WiFiUDP udp;
 
-// ESPNow data
-typedef struct {
-    uint8_t data[300];
-    uint8_t len;
-    uint32_t timestamp;
-} ESPNowPacket;
-
-TelemetryData_t telemetriesData;
-
+TaskHandle_t processingTaskHandle = NULL;
 
+// Processing task batch statistic
+typedef struct {
+    uint32_t wakeups;
+    uint32_t lastDrained;   // frames parsed by the last wakeup
+    uint32_t maxDrained;
+    uint32_t lastWakeupUs;  // duration of the last wakeup
+    uint32_t maxWakeupUs;
+} ProcessingStats_t;
 
-QueueHandle_t packetQueue = NULL;
+ProcessingStats_t processingStats;
 
 void IRAM_ATTR OnDataRecv(const uint8_t *mac_addr, const uint8_t *data, int data_len);
 void processingTask(void* parameter);
+void sendDatagram(const uint8_t* data, uint16_t length);
 void saveWifiToStorage();
 
 bool startAP() {
@@ -210,10 +219,9 @@ void setupESPNow() {
 }
 
 void createTask() {
-    // Make quee for FreeRTOS task
-    packetQueue = xQueueCreate(QUEUE_SIZE, sizeof(ESPNowPacket));
-    if (packetQueue == NULL) {
-        Serial.println("ERROR: Failed to create packet queue!");
+    // Make packet buffer for FreeRTOS task
+    if (!pipelineInit(sendDatagram)) {
+        Serial.println("ERROR: Failed to create packet buffer!");
         ESP.restart();
     }
 
@@ -224,7 +232,7 @@ void createTask() {
         16384,
         NULL,
         3,
-        NULL,
+        &processingTaskHandle,
         1
     );
 
@@ -240,17 +248,26 @@ void setup() {
 
     Serial.println("=== ELRS CRSF Telemetry Parser ===");
 
+#ifdef BENCHMARK_ON_TARGET
+    // Benchmark firmware: measure, print and do not start the bridge
+    benchmarkRun();
+    return;
+#endif
+
     // MAC address setup
     loadMacFromStorage();
     loadWifiFromStorage();
     config.customMAC[0] &= ~0x01;
 
     startWiFi();
+    udp.begin(UDP_PORT);
+    tcpServerSetup();
 
     // ESP-NOW init
     delay(500);
     setupESPNow();
 
+    healthInit();
     createTask();
 
     webSwerverSetup();
@@ -263,28 +280,16 @@ void setup() {
 
 // Callback to read ESPNow
 void IRAM_ATTR OnDataRecv(const uint8_t *mac_addr, const uint8_t *data, int data_len) {
-    // Fast data checking
-    if (data_len < 11 || data_len > 300 || packetQueue == NULL) return;
-
-    // Sync bytes checking
-    if (data[0] != 0x24 || data[1] != 0x58 || data[2] != 0x3C) return;
+    if (processingTaskHandle == NULL) return;
 
-    ESPNowPacket packet;
-    packet.len = data_len;
-    packet.timestamp = micros();
+    // Raw frames, also the rejected ones, for the host replay
+    captureFrame(mac_addr, data, data_len);
 
-    memcpy(packet.data, data, data_len);
+    if (!pipelinePush(mac_addr, data, data_len)) return;
 
-    // Add packet to quee
+    // Wake up processing task
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    BaseType_t result = xQueueSendToBackFromISR(packetQueue, &packet, &xHigherPriorityTaskWoken);
-
-    // Handle Quee overflow
-    if (result == errQUEUE_FULL) {
-        ESPNowPacket dummy;
-        xQueueReceiveFromISR(packetQueue, &dummy, &xHigherPriorityTaskWoken);
-        xQueueSendToBackFromISR(packetQueue, &packet, &xHigherPriorityTaskWoken);
-    }
+    vTaskNotifyGiveFromISR(processingTaskHandle, &xHigherPriorityTaskWoken);
 
     if (xHigherPriorityTaskWoken) {
         portYIELD_FROM_ISR();
@@ -293,43 +298,89 @@ void IRAM_ATTR OnDataRecv(const uint8_t *mac_addr, const uint8_t *data, int data
 
 
 
-// Data processinf task
-void processingTask(void* parameter) {
-    ESPNowPacket packet;
-    uint32_t sendDataTime = millis();;
+// Send datagram to the known GCS, broadcast while none is known.
+// TCP clients get the same encoded bytes.
+void sendDatagram(const uint8_t* data, uint16_t length) {
+    tcpServerWrite(data, length);
 
-    Serial.println("[TASK] Processing task started on Core 1");
+    if (gcsEndpointCount() == 0) {
+        IPAddress broadcastIP(255, 255, 255, 255);
+        udp.beginPacket(broadcastIP, UDP_PORT);
+        udp.write(data, length);
+        udp.endPacket();
+        return;
+    }
 
-    while (1) {
-        if (xQueueReceive(packetQueue, &packet, portMAX_DELAY) == pdTRUE) {
+    for (int i = 0; i < MAX_GCS_ENDPOINTS; i++) {
+        GCSEndpoint_t* endpoint = gcsEndpointAt(i);
+        if (endpoint == NULL) continue;
+        udp.beginPacket(endpoint->ip, endpoint->port);
+        udp.write(data, length);
+        udp.endPacket();
+    }
+}
+
+// Read GCS requests without blocking, the senders become unicast targets
+void receiveGCSMessages() {
+    static uint8_t rxBuffer[512];
+    static uint8_t replyBuffer[1024];
+
+    while (udp.parsePacket() > 0) {
+        IPAddress remoteIP = udp.remoteIP();
+        uint16_t remotePort = udp.remotePort();
+        int len = udp.read(rxBuffer, sizeof(rxBuffer));
 
-            digitalWrite(LED_BUILTIN, HIGH);
+        // Skip own broadcast
+        if (remoteIP == WiFi.localIP() || remoteIP == WiFi.softAPIP()) continue;
 
-            // Check timeout
-            if ((micros() - packet.timestamp) / 1000 > PACKET_TIMEOUT_MS) {
-                digitalWrite(LED_BUILTIN, LOW);
-                continue;
+        if (len > 0) {
+            bool added;
+            int peer = gcsEndpointSeen(remoteIP, remotePort, millis(), &added);
+            if (added) {
+                resetMAVLinkUplink(peer);
             }
 
-            // Parse CRSF data
-            parseCRSFPacket(packet.data, packet.len, &telemetriesData);
-
-            if (millis() >= sendDataTime) {
-                uint8_t* ptrMavlinkData;
-                uint16_t dataLength;
-                IPAddress broadcastIP(255, 255, 255, 255);
-                // Build MAVLink stream
-                if (buildMAVLinkDataStream(&telemetriesData, &ptrMavlinkData, &dataLength)) {
-                    // Send MAVLink stream to UDP
-                    udp.beginPacket(broadcastIP, UDP_PORT);
-                    udp.write(ptrMavlinkData, dataLength);
-                    udp.endPacket();
-                    sendDataTime = millis() + UDP_DATA_SEND_INTERVAL_MS;
-                }
+            // Answer the requests to the asking GCS only
+            uint16_t replyLength = handleMAVLinkUplink(peer, rxBuffer, len, replyBuffer, sizeof(replyBuffer));
+            if (replyLength > 0) {
+                udp.beginPacket(remoteIP, remotePort);
+                udp.write(replyBuffer, replyLength);
+                udp.endPacket();
             }
         }
+    }
+    gcsEndpointsExpire(millis());
+}
 
-        vTaskDelay(1 / portTICK_PERIOD_MS);
+// Data processinf task
+void processingTask(void* parameter) {
+    Serial.println("[TASK] Processing task started on Core 1");
+
+    while (1) {
+        // Block once, then drain everything that is pending
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(pipelineNextWakeup(GCS_POLL_INTERVAL_MS)));
+        uint32_t wakeupStart = micros();
+
+        digitalWrite(LED_BUILTIN, HIGH);
+
+        uint32_t drained = pipelineDrain();
+        receiveGCSMessages();
+        pipelineSendScheduled();
+        tcpServerRun();
+
+        digitalWrite(LED_BUILTIN, LOW);
+
+        // Batch statistic
+        uint32_t wakeupTime = micros() - wakeupStart;
+        processingStats.wakeups++;
+        processingStats.lastDrained = drained;
+        processingStats.lastWakeupUs = wakeupTime;
+        if (drained > processingStats.maxDrained) {
+            processingStats.maxDrained = drained;
+        }
+        if (wakeupTime > processingStats.maxWakeupUs) {
+            processingStats.maxWakeupUs = wakeupTime;
+        }
     }
 }
 
@@ -337,8 +388,8 @@ void printTelemetry(const TelemetryData_t* td) {
     Serial.println("\n══════════ ELRS TELEMETRY ══════════");
 
     // Верхняя строка: основные показатели
-    Serial.printf("📦 Pkts: %lu | ⏱️ Age: %lums\n",
-                 td->statistic.packetCount, millis() - td->lastUpdate);
+    Serial.printf("📦 Pkts: %lu | ❌ CRC: %lu | ⏱️ Age: %lums\n",
+                 td->statistic.packetCount, td->statistic.crcErrors, millis() - td->lastUpdate);
 
     // Батарея с графиком
     Serial.print("🔋 Battery: ");
@@ -376,7 +427,32 @@ void printTelemetry(const TelemetryData_t* td) {
     Serial.println("══════════════════════════════════════");
 }
 
+// Serial commands, also without DEBUG_TO_LOG: 'l' prints the latency
+// histograms as /latency does, 'r' clears them
+static void serialCommands() {
+    while (Serial.available() > 0) {
+        int command = Serial.read();
+        if (command == 'l') {
+            TraceReport_t report;
+            char line[160];
+            int length;
+            traceReportBegin(&report);
+            while ((length = traceReportLine(&report, line, sizeof(line))) > 0) {
+                Serial.write((const uint8_t*)line, length);
+            }
+        } else if (command == 'r') {
+            traceReset();
+            Serial.println("Latency histograms cleared");
+        }
+    }
+}
+
 void loop() {
+#ifdef BENCHMARK_ON_TARGET
+    delay(1000);
+    return;
+#endif
+    serialCommands();
     webServerRun();
 #ifdef DEBUG_TO_LOG
     static uint32_t lastDisplay = 0;
@@ -384,8 +460,20 @@ void loop() {
     static uint32_t lastBlink = 0;
     static bool ledState = false;
 
+    // Newest update and total packets over all vehicles
+    unsigned long lastUpdate = 0;
+    uint32_t packetCount = 0;
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        Vehicle_t* vehicle = vehicleAt(i);
+        if (vehicle == NULL) continue;
+        if (vehicle->telemetry.lastUpdate > lastUpdate) {
+            lastUpdate = vehicle->telemetry.lastUpdate;
+        }
+        packetCount += vehicle->telemetry.statistic.packetCount;
+    }
+
     // Blink LED while data are reading
-    if (millis() - telemetriesData.lastUpdate < 100) {
+    if (millis() - lastUpdate < 100) {
         if (millis() - lastBlink >= 50) {
             ledState = !ledState;
             digitalWrite(LED_BUILTIN, ledState);
@@ -401,11 +489,30 @@ void loop() {
 
     // Show status data
     if (millis() - lastDisplay >= 1000) {
-        unsigned long age = millis() - telemetriesData.lastUpdate;
-
-        Serial.printf("[STATUS] Age:%lums Packets:%lu Queue:%d/%d",
-                     age, telemetriesData.statistic.packetCount,
-                     uxQueueMessagesWaiting(packetQueue), QUEUE_SIZE);
+        unsigned long age = millis() - lastUpdate;
+
+        Serial.printf("[STATUS] Age:%lums Vehicles:%d Packets:%lu Buffer:%lu/%d Overflow:%lu Rejected:%lu",
+                     age, vehicleCount(), packetCount,
+                     ringBufferUsed(&packetBuffer), PACKET_BUFFER_SIZE, packetBuffer.overflowCount,
+                     rejectedPackets);
+
+        // Datagrams per second and average fill
+        static uint32_t lastDatagrams = 0;
+        static uint32_t lastBytes = 0;
+        uint32_t datagrams = udpBatcher.datagrams - lastDatagrams;
+        uint32_t bytes = udpBatcher.bytes - lastBytes;
+        lastDatagrams = udpBatcher.datagrams;
+        lastBytes = udpBatcher.bytes;
+        Serial.printf(" GCS:%d TCP:%d UDP:%lu/s Fill:%lu%%", gcsEndpointCount(), tcpClientCount(), datagrams,
+                     datagrams ? bytes * 100 / (datagrams * DATAGRAM_MTU) : 0);
+
+        Serial.printf(" Batch:%lu/%lu Wakeup:%luus/%luus",
+                     processingStats.lastDrained, processingStats.maxDrained,
+                     processingStats.lastWakeupUs, processingStats.maxWakeupUs);
+
+        Serial.printf(" Load:%u.%u%%/%u.%u%% Drop:%u.%02u%% Timeout:%lu",
+                     healthCoreLoad(0) / 10, healthCoreLoad(0) % 10, healthCoreLoad(1) / 10, healthCoreLoad(1) % 10,
+                     bridgeHealth.dropRate / 100, bridgeHealth.dropRate % 100, timedOutPackets);
 
         if (age > TELEMETRY_TIMEOUT_MS) {
             Serial.println(" (WAITING)");
@@ -420,8 +527,24 @@ void loop() {
 
     // Show full telemetries data
     if (millis() - lastTelemetryPrint >= 5000) {
-        if (telemetriesData.statistic.packetCount > 0 && millis() - telemetriesData.lastUpdate < 2000) {
-            printTelemetry(&telemetriesData);
+        static TelemetryData_t td;
+        for (int i = 0; i < MAX_VEHICLES; i++) {
+            if (!vehicleSnapshot(i, &td)) continue;
+            Vehicle_t* vehicle = vehicleAt(i);
+            if (td.statistic.packetCount > 0 && millis() - td.lastUpdate < 2000) {
+                Serial.printf("\nVehicle %d (%s)", vehicle->systemId, macToString(vehicle->mac).c_str());
+                printTelemetry(&td);
+            }
+        }
+
+        // Where the time goes, from the ESP-NOW callback to the UDP send
+        if (traceCount(TRACE_SPAN_TOTAL) > 0) {
+            Serial.print("[LATENCY]");
+            for (int span = 0; span < TRACE_SPANS; span++) {
+                Serial.printf(" %s:%lu/%lu/%luus", traceSpanName(span),
+                             tracePercentile(span, 50), tracePercentile(span, 99), traceMax(span));
+            }
+            Serial.println(" (p50/p99/max)");
         }
         lastTelemetryPrint = millis();
     }
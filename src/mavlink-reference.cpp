@@ -0,0 +1,56 @@
+#include "mavlink-reference.h"
+#include "crsf.h"
+#include "health.h"
+
+bool isArmed(const char* flightModeString);
+
+bool mavlinkPackReference(const TelemetryData_t* t, uint8_t systemId, uint32_t msgId,
+                          uint8_t sequence, mavlink_message_t* msg) {
+    mavlink_get_channel_status(MAVLINK_COMM_0)->current_tx_seq = sequence;
+    const uint8_t component = MAV_COMP_ID_AUTOPILOT1;
+
+    switch (msgId) {
+        case MAVLINK_MSG_ID_GPS_RAW_INT:
+            mavlink_msg_gps_raw_int_pack_chan(systemId, component, MAVLINK_COMM_0, msg,
+                (uint64_t)t->received[TELEMETRY_GROUP_GPS] * 1000, t->gps.satellites > 5 ? 3 : 0,
+                t->gps.latitude * 1e7, t->gps.longitude * 1e7, t->gps.altitude * 1000.0f,
+                UINT16_MAX, UINT16_MAX, t->gps.groundSpeed * 100.0f, t->gps.heading * 100.0f,
+                t->gps.satellites, t->gps.altitude * 1000.0f, UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX, 0);
+            return true;
+        case MAVLINK_MSG_ID_GLOBAL_POSITION_INT:
+            mavlink_msg_global_position_int_pack_chan(systemId, component, MAVLINK_COMM_0, msg,
+                t->received[TELEMETRY_GROUP_GPS], t->gps.latitude * 1e7, t->gps.longitude * 1e7,
+                t->gps.altitude * 1000.0f, t->gps.altitude * 1000.0f,
+                t->gps.groundSpeed * cos(t->gps.heading / 57.3) * 100,
+                t->gps.groundSpeed * sin(t->gps.heading / 57.3) * 100, 0, t->gps.heading);
+            return true;
+        case MAVLINK_MSG_ID_ATTITUDE:
+            mavlink_msg_attitude_pack_chan(systemId, component, MAVLINK_COMM_0, msg,
+                t->received[TELEMETRY_GROUP_ATTITUDE], t->attitude.roll, t->attitude.pitch, t->attitude.yaw, 0, 0, 0);
+            return true;
+        case MAVLINK_MSG_ID_HEARTBEAT:
+            mavlink_msg_heartbeat_pack_chan(systemId, component, MAVLINK_COMM_0, msg,
+                MAV_TYPE_QUADROTOR, MAV_AUTOPILOT_GENERIC, 0, 0,
+                t->flightMode.enabled && !isArmed(t->flightMode.mode) ? MAV_STATE_STANDBY : MAV_STATE_ACTIVE);
+            return true;
+        case MAVLINK_MSG_ID_SYS_STATUS: {
+            uint32_t errors = bridgeHealth.errors + t->statistic.crcErrors;
+            mavlink_msg_sys_status_pack_chan(systemId, component, MAVLINK_COMM_0, msg,
+                35843, 35843, 35843 & 1023, bridgeHealth.load,
+                t->battery.enabled ? (uint16_t)(t->battery.voltage * 1e3) : UINT16_MAX,
+                t->battery.enabled ? (int16_t)(t->battery.current * 10) : -1,
+                t->battery.enabled ? t->battery.remaining : -1,
+                bridgeHealth.dropRate, errors > UINT16_MAX ? UINT16_MAX : errors, 0, 0, 0, 0, 0, 0, 0);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+uint16_t mavlinkWriteReference(const TelemetryData_t* telemetry, uint8_t systemId, uint32_t msgId,
+                               uint8_t sequence, uint8_t* out) {
+    mavlink_message_t msg;
+    if (!mavlinkPackReference(telemetry, systemId, msgId, sequence, &msg)) return 0;
+    return mavlink_msg_to_send_buffer(out, &msg);
+}
@@ -0,0 +1,19 @@
+#ifndef _MAVLINK_REFERENCE_H_
+#define _MAVLINK_REFERENCE_H_
+#include <Arduino.h>
+#include "common/mavlink.h"
+
+struct TelemetryData_t;
+
+// The messages of buildMAVLinkDataStream encoded with the generated
+// mavlink_msg_*_pack_chan + mavlink_msg_to_send_buffer, for the host
+// tests and the benchmark. Not part of the bridge firmware.
+
+// Packs one message into msg with the given sequence number, false for an
+// unknown message ID
+bool mavlinkPackReference(const TelemetryData_t* telemetry, uint8_t systemId, uint32_t msgId,
+                          uint8_t sequence, mavlink_message_t* msg);
+// The same, serialized into out (MAVLINK_MAX_PACKET_LEN), returns the length
+uint16_t mavlinkWriteReference(const TelemetryData_t* telemetry, uint8_t systemId, uint32_t msgId,
+                               uint8_t sequence, uint8_t* out);
+#endif
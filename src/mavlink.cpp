@@ -1,7 +1,11 @@
+#include <esp_timer.h>
 #include "crsf.h"
 #include "common/mavlink.h"
+#include "scheduler.h"
+#include "vehicles.h"
+#include "gcs.h"
+#include "health.h"
 
-#define MAVLINK_SYSTEM_ID 1
 #define MAVLINK_COMPONENT_ID MAV_COMP_ID_AUTOPILOT1
 
 bool isArmed(const char* flightModeString) {
@@ -22,151 +26,473 @@ bool isArmed(const char* flightModeString) {
     return true;
 }
 
-bool buildMAVLinkDataStream(TelemetryData_t* telemetry, uint8_t** ptrMavlinkData, uint16_t* ptrDataLength) {
-    mavlink_message_t mavMsg;
-    static uint8_t mavBuffer[MAVLINK_MAX_PACKET_LEN * 4];
+// Direct-to-wire MAVLink v2 writer.
+// The payload is written in place after the header, then trimmed, framed and
+// checksummed in the output buffer, the same way mavlink_finalize_message_buffer
+// and mavlink_msg_to_send_buffer do it, without an intermediate mavlink_message_t.
+static uint8_t txSequence[256];    // per system ID
+
+static inline void putU16(uint8_t* buf, uint16_t value) { memcpy(buf, &value, 2); }
+static inline void putI16(uint8_t* buf, int16_t value) { memcpy(buf, &value, 2); }
+static inline void putU32(uint8_t* buf, uint32_t value) { memcpy(buf, &value, 4); }
+static inline void putI32(uint8_t* buf, int32_t value) { memcpy(buf, &value, 4); }
+static inline void putU64(uint8_t* buf, uint64_t value) { memcpy(buf, &value, 8); }
+static inline void putFloat(uint8_t* buf, float value) { memcpy(buf, &value, 4); }
+
+static inline uint8_t* wirePayload(uint8_t* mavBuffer) {
+    return mavBuffer + MAVLINK_NUM_HEADER_BYTES;
+}
+
+static uint16_t wireFinalize(uint8_t* mavBuffer, uint8_t systemId, uint32_t msgId, uint8_t length, uint8_t crcExtra) {
+    uint8_t* payload = wirePayload(mavBuffer);
+
+    // MAVLink 2 trims trailing zero bytes of the payload
+    while (length > 1 && payload[length - 1] == 0) {
+        length--;
+    }
+
+    mavBuffer[0] = MAVLINK_STX;
+    mavBuffer[1] = length;
+    mavBuffer[2] = 0;   // incompat_flags
+    mavBuffer[3] = 0;   // compat_flags
+    mavBuffer[4] = txSequence[systemId]++;
+    mavBuffer[5] = systemId;
+    mavBuffer[6] = MAVLINK_COMPONENT_ID;
+    mavBuffer[7] = msgId & 0xFF;
+    mavBuffer[8] = (msgId >> 8) & 0xFF;
+    mavBuffer[9] = (msgId >> 16) & 0xFF;
+
+    uint16_t checksum = crc_calculate(mavBuffer + 1, MAVLINK_CORE_HEADER_LEN + length);
+    crc_accumulate(crcExtra, &checksum);
+    payload[length] = (uint8_t)(checksum & 0xFF);
+    payload[length + 1] = (uint8_t)(checksum >> 8);
+
+    return MAVLINK_NUM_NON_PAYLOAD_BYTES + length;
+}
+
+// Writes a message from its generated struct, the packed struct already is
+// in wire order on little-endian targets
+static uint16_t wireStruct(uint8_t* mavBuffer, uint8_t systemId, uint32_t msgId, const void* packet, uint8_t length, uint8_t crcExtra) {
+    memcpy(wirePayload(mavBuffer), packet, length);
+    return wireFinalize(mavBuffer, systemId, msgId, length, crcExtra);
+}
+
+// GPS_RAW_INT
+static uint16_t packGpsRawInt(TelemetryData_t* telemetry, uint8_t systemId, uint8_t* mavBuffer) {
+    uint8_t* buf = wirePayload(mavBuffer);
+
+    // time_usec Timestamp (microseconds since system boot)
+    putU64(buf + 0, (uint64_t)telemetry->received[TELEMETRY_GROUP_GPS] * 1000);
+    // lat Latitude in 1E7 degrees
+    putI32(buf + 8, telemetry->gps.latitude * 1e7);
+    // lon Longitude in 1E7 degrees
+    putI32(buf + 12, telemetry->gps.longitude * 1e7);
+    // alt Altitude in 1E3 meters (millimeters) above MSL
+    putI32(buf + 16, telemetry->gps.altitude * 1000.0f);
+    // eph, epv GPS HDOP/VDOP. If unknown, set to: UINT16_MAX
+    putU16(buf + 20, UINT16_MAX);
+    putU16(buf + 22, UINT16_MAX);
+    // vel GPS ground speed (m/s * 100)
+    putU16(buf + 24, telemetry->gps.groundSpeed * 100.0f);
+    // cog Course over ground in degrees * 100, 0.0..359.99 degrees
+    putU16(buf + 26, telemetry->gps.heading * 100.0f);
+    // fix_type 0-1: no fix, 2: 2D fix, 3: 3D fix
+    buf[28] = telemetry->gps.satellites > 5 ? 3 : 0;
+    // satellites_visible Number of satellites visible
+    buf[29] = telemetry->gps.satellites;
+    // Altitude [mm] (above WGS84, EGM96 ellipsoid)
+    putI32(buf + 30, telemetry->gps.altitude * 1000.0f);
+    // h_acc, v_acc, vel_acc, hdg_acc - Unknown
+    putU32(buf + 34, UINT32_MAX);
+    putU32(buf + 38, UINT32_MAX);
+    putU32(buf + 42, UINT32_MAX);
+    putU32(buf + 46, UINT32_MAX);
+    // Yaw in earth frame from north - Unused
+    putU16(buf + 50, 0);
+
+    return wireFinalize(mavBuffer, systemId, MAVLINK_MSG_ID_GPS_RAW_INT,
+        MAVLINK_MSG_ID_GPS_RAW_INT_LEN, MAVLINK_MSG_ID_GPS_RAW_INT_CRC);
+}
+
+// GLOBAL_POSITION_INT
+static uint16_t packGlobalPositionInt(TelemetryData_t* telemetry, uint8_t systemId, uint8_t* mavBuffer) {
+    uint8_t* buf = wirePayload(mavBuffer);
+
+    // time_boot_ms Timestamp
+    putU32(buf + 0, telemetry->received[TELEMETRY_GROUP_GPS]);
+    // lat, lon in 1E7 degrees
+    putI32(buf + 4, telemetry->gps.latitude * 1e7);
+    putI32(buf + 8, telemetry->gps.longitude * 1e7);
+    // alt Altitude in millimeters above MSL
+    putI32(buf + 12, telemetry->gps.altitude * 1000.0f);
+    // relative_alt: do not have AGL, to use MSL instead of
+    putI32(buf + 16, telemetry->gps.altitude * 1000.0f);
+    // Ground X/Y Speed (Latitude/Longitude), expressed as m/s * 100
+    putI16(buf + 20, telemetry->gps.groundSpeed * cos(telemetry->gps.heading / 57.3) * 100);
+    putI16(buf + 22, telemetry->gps.groundSpeed * sin(telemetry->gps.heading / 57.3) * 100);
+    // Ground Z Speed: do not have Vz
+    putI16(buf + 24, 0);
+    // hdg Current heading in degrees, in compass units (0..360, 0=north)
+    putU16(buf + 26, telemetry->gps.heading);
+
+    return wireFinalize(mavBuffer, systemId, MAVLINK_MSG_ID_GLOBAL_POSITION_INT,
+        MAVLINK_MSG_ID_GLOBAL_POSITION_INT_LEN, MAVLINK_MSG_ID_GLOBAL_POSITION_INT_CRC);
+}
+
+// ATTITUDE
+static uint16_t packAttitude(TelemetryData_t* telemetry, uint8_t systemId, uint8_t* mavBuffer) {
+    uint8_t* buf = wirePayload(mavBuffer);
+
+    // time_boot_ms Timestamp (milliseconds since system boot)
+    putU32(buf + 0, telemetry->received[TELEMETRY_GROUP_ATTITUDE]);
+    // roll, pitch, yaw angles (rad)
+    putFloat(buf + 4, telemetry->attitude.roll);
+    putFloat(buf + 8, telemetry->attitude.pitch);
+    putFloat(buf + 12, telemetry->attitude.yaw);
+    // roll, pitch, yaw angular speed (rad/s)
+    putFloat(buf + 16, 0);
+    putFloat(buf + 20, 0);
+    putFloat(buf + 24, 0);
+
+    return wireFinalize(mavBuffer, systemId, MAVLINK_MSG_ID_ATTITUDE,
+        MAVLINK_MSG_ID_ATTITUDE_LEN, MAVLINK_MSG_ID_ATTITUDE_CRC);
+}
+
+// HEARTBEAT
+static uint16_t packHeartbeat(TelemetryData_t* telemetry, uint8_t systemId, uint8_t* mavBuffer) {
+    uint8_t* buf = wirePayload(mavBuffer);
+
+    // custom_mode A bitfield for use for autopilot-specific flags
+    putU32(buf + 0, 0);
+    // type Type of the MAV
+    buf[4] = MAV_TYPE_QUADROTOR;
+    // autopilot Autopilot type / class
+    buf[5] = MAV_AUTOPILOT_GENERIC;
+    // base_mode System mode bitfield
+    buf[6] = 0;
+    // system_status System status flag, see MAV_STATE ENUM
+    buf[7] = telemetry->flightMode.enabled ? (isArmed(telemetry->flightMode.mode) ?  MAV_STATE_ACTIVE : MAV_STATE_STANDBY) : MAV_STATE_ACTIVE;
+    // mavlink_version
+    buf[8] = 3;
+
+    return wireFinalize(mavBuffer, systemId, MAVLINK_MSG_ID_HEARTBEAT,
+        MAVLINK_MSG_ID_HEARTBEAT_LEN, MAVLINK_MSG_ID_HEARTBEAT_CRC);
+}
+
+// Bridge health as seen by one vehicle: its own CRC errors count as comm errors
+static void vehicleHealth(const TelemetryData_t* telemetry, BridgeHealth_t* health) {
+    uint32_t errors = bridgeHealth.errors + telemetry->statistic.crcErrors;
+    health->load = bridgeHealth.load;
+    health->dropRate = bridgeHealth.dropRate;
+    health->errors = errors > UINT16_MAX ? UINT16_MAX : errors;
+}
+
+// SYS_STATUS
+static uint16_t packSysStatus(TelemetryData_t* telemetry, uint8_t systemId, uint8_t* mavBuffer) {
+    uint8_t* buf = wirePayload(mavBuffer);
+    BridgeHealth_t health;
+    vehicleHealth(telemetry, &health);
+
+    // onboard_control_sensors_present, enabled, health bitmasks
+    // Indices: 0: 3D gyro, 1: 3D acc, 2: 3D mag, 3: absolute pressure, 4: differential pressure, 5: GPS,
+    // 6: optical flow, 7: computer vision position, 8: laser based position, 9: external ground-truth.
+    // Controllers: 10: 3D angular rate control 11: attitude stabilization, 12: yaw position,
+    // 13: z/altitude control, 14: x/y position control, 15: motor outputs / control
+    putU32(buf + 0, 35843);
+    putU32(buf + 4, 35843);
+    putU32(buf + 8, 35843 & 1023);
+    // load Maximum usage in percent of the mainloop time, (0%: 0, 100%: 1000)
+    putU16(buf + 12, health.load);
+    // voltage_battery Battery voltage, in millivolts (UINT16_MAX: not sent)
+    putU16(buf + 14, telemetry->battery.enabled ? (uint16_t)(telemetry->battery.voltage * 1e3) : UINT16_MAX);
+    // current_battery Battery current, in 10*milliamperes (-1: not measured)
+    putI16(buf + 16, telemetry->battery.enabled ? (int16_t)(telemetry->battery.current * 10) : -1);
+    // drop_rate_comm Communication drops in percent, (0%: 0, 100%: 10'000)
+    putU16(buf + 18, health.dropRate);
+    // errors_comm Communication errors
+    putU16(buf + 20, health.errors);
+    // errors_count1..4 Autopilot-specific errors
+    putU16(buf + 22, 0);
+    putU16(buf + 24, 0);
+    putU16(buf + 26, 0);
+    putU16(buf + 28, 0);
+    // battery_remaining Remaining battery energy: (0%: 0, 100%: 100, -1: not measured)
+    buf[30] = telemetry->battery.enabled ? telemetry->battery.remaining : (uint8_t)-1;
+    // extended parameters, set to zero
+    putU32(buf + 31, 0);
+    putU32(buf + 35, 0);
+    putU32(buf + 39, 0);
+
+    return wireFinalize(mavBuffer, systemId, MAVLINK_MSG_ID_SYS_STATUS,
+        MAVLINK_MSG_ID_SYS_STATUS_LEN, MAVLINK_MSG_ID_SYS_STATUS_CRC);
+}
+
+// Encoded messages are kept per vehicle. Until a group a message is built
+// from changes, it is re-sent with only the sequence and the checksum renewed.
+#define MESSAGE_CACHE_LEN (MAVLINK_NUM_NON_PAYLOAD_BYTES + MAVLINK_MSG_ID_GPS_RAW_INT_LEN)
+
+struct MessageCache_t {
+    uint8_t length;     // 0 when it has to be encoded
+    uint8_t bytes[MESSAGE_CACHE_LEN];
+};
+
+typedef uint16_t (*MessagePacker_t)(TelemetryData_t* telemetry, uint8_t systemId, uint8_t* mavBuffer);
+
+static MessageCache_t messageCache[MAX_VEHICLES + 1][SCHEDULED_MESSAGES];   // by system ID
+static BridgeHealth_t encodedHealth[MAX_VEHICLES + 1];   // in the cached SYS_STATUS
+
+static const uint8_t messageCrcExtra[SCHEDULED_MESSAGES] = {
+    MAVLINK_MSG_ID_HEARTBEAT_CRC,
+    MAVLINK_MSG_ID_SYS_STATUS_CRC,
+    MAVLINK_MSG_ID_GPS_RAW_INT_CRC,
+    MAVLINK_MSG_ID_GLOBAL_POSITION_INT_CRC,
+    MAVLINK_MSG_ID_ATTITUDE_CRC,
+};
+
+// Drops the cached messages built from groups changed since the last call
+static void invalidateMessages(TelemetryData_t* telemetry, uint8_t systemId) {
+    if (systemId > MAX_VEHICLES) return;
+
+    // SYS_STATUS also carries the bridge health
+    BridgeHealth_t health;
+    vehicleHealth(telemetry, &health);
+    if (memcmp(&health, &encodedHealth[systemId], sizeof(BridgeHealth_t)) != 0) {
+        messageCache[systemId][SCHEDULED_SYS_STATUS].length = 0;
+        encodedHealth[systemId] = health;
+    }
+
+    if (telemetry->dirty == 0) return;
+
+    uint32_t stale = schedulerMessagesOf(telemetry->dirty);
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        if (stale & SCHEDULED_BIT(slot)) {
+            messageCache[systemId][slot].length = 0;
+        }
+    }
+    telemetry->dirty = 0;
+}
+
+static uint16_t emitMessage(int slot, MessagePacker_t pack, TelemetryData_t* telemetry, uint8_t systemId, uint8_t* mavBuffer) {
+    if (systemId > MAX_VEHICLES) {
+        return pack(telemetry, systemId, mavBuffer);
+    }
+
+    MessageCache_t* cached = &messageCache[systemId][slot];
+    if (cached->length == 0) {
+        uint16_t length = pack(telemetry, systemId, mavBuffer);
+        memcpy(cached->bytes, mavBuffer, length);
+        cached->length = length;
+        return length;
+    }
+
+    memcpy(mavBuffer, cached->bytes, cached->length);
+    mavBuffer[4] = txSequence[systemId]++;
+
+    uint8_t payloadLength = mavBuffer[1];
+    uint8_t* crc = wirePayload(mavBuffer) + payloadLength;
+    uint16_t checksum = crc_calculate(mavBuffer + 1, MAVLINK_CORE_HEADER_LEN + payloadLength);
+    crc_accumulate(messageCrcExtra[slot], &checksum);
+    crc[0] = (uint8_t)(checksum & 0xFF);
+    crc[1] = (uint8_t)(checksum >> 8);
+
+    return cached->length;
+}
+
+// Max length of the stream of the selected messages
+uint16_t mavlinkStreamMaxLength(uint32_t messages) {
+    static const uint8_t payloadLength[SCHEDULED_MESSAGES] = {
+        MAVLINK_MSG_ID_HEARTBEAT_LEN,
+        MAVLINK_MSG_ID_SYS_STATUS_LEN,
+        MAVLINK_MSG_ID_GPS_RAW_INT_LEN,
+        MAVLINK_MSG_ID_GLOBAL_POSITION_INT_LEN,
+        MAVLINK_MSG_ID_ATTITUDE_LEN,
+    };
+    uint16_t length = 0;
+
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        if (messages & SCHEDULED_BIT(slot)) {
+            length += MAVLINK_NUM_NON_PAYLOAD_BYTES + payloadLength[slot];
+        }
+    }
+    return length;
+}
+
+// Builds the selected MAVLink messages, one bit per ScheduledMessage_e slot.
+// mavBuffer must hold mavlinkStreamMaxLength(messages) bytes, returns the length.
+uint16_t buildMAVLinkDataStream(TelemetryData_t* telemetry, uint8_t systemId, uint32_t messages, uint8_t* mavBuffer) {
     uint16_t dataLength = 0;
 
-    if (ptrMavlinkData) {
-        *ptrMavlinkData = mavBuffer;
-    } else {
-        return false;
+    if (mavBuffer == NULL) return 0;
+
+    invalidateMessages(telemetry, systemId);
+
+    if ((messages & SCHEDULED_BIT(SCHEDULED_GPS_RAW_INT)) && telemetry->gps.enabled) {
+        dataLength += emitMessage(SCHEDULED_GPS_RAW_INT, packGpsRawInt, telemetry, systemId, mavBuffer + dataLength);
     }
 
-    if (telemetry->gps.enabled) {
-        mavlink_msg_gps_raw_int_pack(MAVLINK_SYSTEM_ID, MAVLINK_COMPONENT_ID, &mavMsg,
-            // time_usec Timestamp (microseconds since UNIX epoch or microseconds since system boot)
-            micros(),
-            // fix_type 0-1: no fix, 2: 2D fix, 3: 3D fix. Some applications will not use the value of this field unless it is at least two, so always correctly fill in the fix.
-            telemetry->gps.satellites > 5 ? 3 : 0,
-            // lat Latitude in 1E7 degrees
-            telemetry->gps.latitude * 1e7,
-            // lon Longitude in 1E7 degrees
-            telemetry->gps.longitude * 1e7,
-            // alt Altitude in 1E3 meters (millimeters) above MSL
-            telemetry->gps.altitude * 1000.0f,
-            // eph GPS HDOP horizontal dilution of position (unitless * 100). If unknown, set to: UINT16_MAX
-            UINT16_MAX,
-            // epv GPS VDOP vertical dilution of position (unitless * 100). If unknown, set to: UINT16_MAX
-            UINT16_MAX,
-            // vel GPS ground speed (m/s * 100). If unknown, set to: UINT16_MAX
-            telemetry->gps.groundSpeed * 100.0f,
-            // cog Course over ground (NOT heading, but direction of movement) in degrees * 100, 0.0..359.99 degrees. If unknown, set to: UINT16_MAX
-            telemetry->gps.heading * 100.0f,
-            // satellites_visible Number of satellites visible. If unknown, set to 255
-            telemetry->gps.satellites,
-            // Altitude [mm] (above WGS84, EGM96 ellipsoid). Positive for up.
-            telemetry->gps.altitude * 1000.0f,
-            // h_acc [mm] Position uncertainty
-            UINT32_MAX,
-            // v_acc [mm] Altitude uncertainty
-            UINT32_MAX,
-            // vel_acc [mm/s] Speed uncertainty
-            UINT32_MAX,
-            // [degE5] Heading / track uncertainty - Unused
-            UINT32_MAX,
-            //Yaw in earth frame from north. Use 0 if this GPS does not provide yaw - Unused
-            0);
-        dataLength += mavlink_msg_to_send_buffer(mavBuffer + dataLength, &mavMsg);
-
-        mavlink_msg_global_position_int_pack(MAVLINK_SYSTEM_ID, MAVLINK_COMPONENT_ID, &mavMsg,
-            // time_usec Timestamp (microseconds since UNIX epoch or microseconds since system boot)
-            micros(),
-            // lat Latitude in 1E7 degrees
-            telemetry->gps.latitude * 1e7,
-            // lon Longitude in 1E7 degrees
-             telemetry->gps.longitude * 1e7,
-            // alt Altitude in 1E3 meters (millimeters) above MSL
-            telemetry->gps.altitude * 1000.0f,
-            // relative_alt Altitude above ground in meters, expressed as * 1000 (millimeters)
-            telemetry->gps.altitude * 1000.0f, // do not have AGL, to use MSL instead of
-            // Ground X Speed (Latitude), expressed as m/s * 100
-            telemetry->gps.groundSpeed * cos(telemetry->gps.heading / 57.3) * 100,
-            // Ground Y Speed (Longitude), expressed as m/s * 100
-            telemetry->gps.groundSpeed * sin(telemetry->gps.heading / 57.3) * 100,
-            // Ground Z Speed (Altitude), expressed as m/s * 100
-            0,  // Do not have Vz
-            // heading Current heading in degrees, in compass units (0..360, 0=north)
-            telemetry->gps.heading
-        );
-        dataLength += mavlink_msg_to_send_buffer(mavBuffer + dataLength, &mavMsg);
+    if ((messages & SCHEDULED_BIT(SCHEDULED_GLOBAL_POSITION_INT)) && telemetry->gps.enabled) {
+        dataLength += emitMessage(SCHEDULED_GLOBAL_POSITION_INT, packGlobalPositionInt, telemetry, systemId, mavBuffer + dataLength);
     }
 
-    if (telemetry->attitude.enabled) {
-        mavlink_msg_attitude_pack(MAVLINK_SYSTEM_ID, MAVLINK_COMPONENT_ID, &mavMsg,
-            // time_boot_ms Timestamp (milliseconds since system boot)
-            millis(),
-            // roll Roll angle (rad)
-            telemetry->attitude.roll,
-            // pitch Pitch angle (rad)
-            telemetry->attitude.pitch,
-            // yaw Yaw angle (rad)
-            telemetry->attitude.yaw,
-            // rollspeed Roll angular speed (rad/s)
-            0,
-            // pitchspeed Pitch angular speed (rad/s)
-            0,
-            // yawspeed Yaw angular speed (rad/s)
-            0);
-        dataLength += mavlink_msg_to_send_buffer(mavBuffer + dataLength, &mavMsg);
+    if ((messages & SCHEDULED_BIT(SCHEDULED_ATTITUDE)) && telemetry->attitude.enabled) {
+        dataLength += emitMessage(SCHEDULED_ATTITUDE, packAttitude, telemetry, systemId, mavBuffer + dataLength);
     }
 
-    mavlink_msg_heartbeat_pack(MAVLINK_SYSTEM_ID, MAVLINK_COMPONENT_ID, &mavMsg,
-        // type Type of the MAV (quadrotor, helicopter, etc., up to 15 types, defined in MAV_TYPE ENUM)
-        MAV_TYPE_QUADROTOR,
-        // autopilot Autopilot type / class. defined in MAV_AUTOPILOT ENUM
-        MAV_AUTOPILOT_GENERIC,
-        // base_mode System mode bitfield, see MAV_MODE_FLAGS ENUM in mavlink/include/mavlink_types.h
-        0,
-        // custom_mode A bitfield for use for autopilot-specific flags.
-        0,
-        // system_status System status flag, see MAV_STATE ENUM
-        telemetry->flightMode.enabled ? (isArmed(telemetry->flightMode.mode) ?  MAV_STATE_ACTIVE : MAV_STATE_STANDBY) : MAV_STATE_ACTIVE
-    );
-    dataLength += mavlink_msg_to_send_buffer(mavBuffer + dataLength, &mavMsg);
-
-    if (telemetry->battery.enabled) {
-        mavlink_msg_sys_status_pack(MAVLINK_SYSTEM_ID, MAVLINK_COMPONENT_ID, &mavMsg,
-            // onboard_control_sensors_present Bitmask showing which onboard controllers and sensors are present.
-            //Value of 0: not present. Value of 1: present. Indices: 0: 3D gyro, 1: 3D acc, 2: 3D mag, 3: absolute pressure,
-            // 4: differential pressure, 5: GPS, 6: optical flow, 7: computer vision position, 8: laser based position,
-            // 9: external ground-truth (Vicon or Leica). Controllers: 10: 3D angular rate control 11: attitude stabilization,
-            // 12: yaw position, 13: z/altitude control, 14: x/y position control, 15: motor outputs / control
-            35843,
-            // onboard_control_sensors_enabled Bitmask showing which onboard controllers and sensors are enabled
-            35843,
-            // onboard_control_sensors_health Bitmask showing which onboard controllers and sensors are operational or have an error.
-            35843 & 1023,
-            // load Maximum usage in percent of the mainloop time, (0%: 0, 100%: 1000) should be always below 1000
-            0,
-            // voltage_battery Battery voltage, in millivolts (1 = 1 millivolt)
-            telemetry->battery.voltage * 1e3,
-            // current_battery Battery current, in 10*milliamperes (1 = 10 milliampere), -1: autopilot does not measure the current
-            telemetry->battery.current * 10,
-            // battery_remaining Remaining battery energy: (0%: 0, 100%: 100), -1: autopilot estimate the remaining battery
-            telemetry->battery.remaining,
-            // drop_rate_comm Communication drops in percent, (0%: 0, 100%: 10'000), (UART, I2C, SPI, CAN), dropped packets on all links (packets that were corrupted on reception on the MAV)
-            0,
-            // errors_comm Communication errors (UART, I2C, SPI, CAN), dropped packets on all links (packets that were corrupted on reception on the MAV)
-            0,
-            // errors_count1 Autopilot-specific errors
-            0,
-            // errors_count2 Autopilot-specific errors
-            0,
-            // errors_count3 Autopilot-specific errors
-            0,
-            // errors_count4 Autopilot-specific errors
-            0,
-            // extended parameters, set to zero
-            0,
-            0,
-            0);
-        dataLength += mavlink_msg_to_send_buffer(mavBuffer + dataLength, &mavMsg);
+    if (messages & SCHEDULED_BIT(SCHEDULED_HEARTBEAT)) {
+        dataLength += emitMessage(SCHEDULED_HEARTBEAT, packHeartbeat, telemetry, systemId, mavBuffer + dataLength);
     }
 
-    if (ptrDataLength) {
-        *ptrDataLength = dataLength;
+    if (messages & SCHEDULED_BIT(SCHEDULED_SYS_STATUS)) {
+        dataLength += emitMessage(SCHEDULED_SYS_STATUS, packSysStatus, telemetry, systemId, mavBuffer + dataLength);
     }
 
-    return dataLength > 0;
-}
\ No newline at end of file
+    return dataLength;
+}
+
+// Per-peer uplink parser state
+static mavlink_message_t rxMessage[MAX_GCS_ENDPOINTS];
+static mavlink_status_t rxStatus[MAX_GCS_ENDPOINTS];
+
+// Requests addressed to broadcast or to one of our vehicles
+static bool isOwnSystem(uint8_t targetSystem) {
+    if (vehicleCount() == 0) return false;
+    return targetSystem == 0 || targetSystem <= vehicleCount();
+}
+
+static uint16_t packCommandAck(const mavlink_message_t* request, uint8_t systemId, uint16_t command, uint8_t result, uint8_t* mavBuffer) {
+    mavlink_command_ack_t ack = {};
+    ack.command = command;
+    ack.result = result;
+    ack.target_system = request->sysid;
+    ack.target_component = request->compid;
+    return wireStruct(mavBuffer, systemId, MAVLINK_MSG_ID_COMMAND_ACK, &ack,
+        MAVLINK_MSG_ID_COMMAND_ACK_LEN, MAVLINK_MSG_ID_COMMAND_ACK_CRC);
+}
+
+static uint16_t packAutopilotVersion(uint8_t systemId, uint8_t* mavBuffer) {
+    mavlink_autopilot_version_t version = {};
+    version.capabilities = MAV_PROTOCOL_CAPABILITY_MAVLINK2;
+    return wireStruct(mavBuffer, systemId, MAVLINK_MSG_ID_AUTOPILOT_VERSION, &version,
+        MAVLINK_MSG_ID_AUTOPILOT_VERSION_LEN, MAVLINK_MSG_ID_AUTOPILOT_VERSION_CRC);
+}
+
+static uint16_t handleCommandLong(const mavlink_message_t* request, uint8_t* mavBuffer) {
+    mavlink_command_long_t cmd;
+    mavlink_msg_command_long_decode(request, &cmd);
+    if (!isOwnSystem(cmd.target_system)) return 0;
+
+    uint8_t systemId = cmd.target_system ? cmd.target_system : 1;
+    uint16_t replyLength = 0;
+    uint8_t result = MAV_RESULT_ACCEPTED;
+
+    switch (cmd.command) {
+        case MAV_CMD_SET_MESSAGE_INTERVAL:
+            if (!schedulerSetMessageInterval((uint32_t)cmd.param1, (int32_t)cmd.param2)) {
+                result = MAV_RESULT_DENIED;
+            }
+            break;
+
+        case MAV_CMD_GET_MESSAGE_INTERVAL: {
+            mavlink_message_interval_t interval;
+            interval.message_id = (uint16_t)cmd.param1;
+            interval.interval_us = schedulerGetMessageInterval(interval.message_id);
+            replyLength += wireStruct(mavBuffer, systemId, MAVLINK_MSG_ID_MESSAGE_INTERVAL, &interval,
+                MAVLINK_MSG_ID_MESSAGE_INTERVAL_LEN, MAVLINK_MSG_ID_MESSAGE_INTERVAL_CRC);
+            break;
+        }
+
+        case MAV_CMD_REQUEST_AUTOPILOT_CAPABILITIES:
+            replyLength += packAutopilotVersion(systemId, mavBuffer);
+            break;
+
+        case MAV_CMD_REQUEST_MESSAGE:
+            if ((uint32_t)cmd.param1 == MAVLINK_MSG_ID_AUTOPILOT_VERSION) {
+                replyLength += packAutopilotVersion(systemId, mavBuffer);
+            } else {
+                result = MAV_RESULT_UNSUPPORTED;
+            }
+            break;
+
+        default:
+            result = MAV_RESULT_UNSUPPORTED;
+            break;
+    }
+
+    replyLength += packCommandAck(request, systemId, cmd.command, result, mavBuffer + replyLength);
+    return replyLength;
+}
+
+// Answers one GCS message, returns the reply length
+static uint16_t handleGCSMessage(const mavlink_message_t* request, uint8_t* mavBuffer) {
+    switch (request->msgid) {
+        case MAVLINK_MSG_ID_COMMAND_LONG:
+            return handleCommandLong(request, mavBuffer);
+
+        case MAVLINK_MSG_ID_REQUEST_DATA_STREAM: {
+            mavlink_request_data_stream_t stream;
+            mavlink_msg_request_data_stream_decode(request, &stream);
+            if (isOwnSystem(stream.target_system)) {
+                schedulerRequestDataStream(stream.req_stream_id, stream.req_message_rate, stream.start_stop != 0);
+            }
+            return 0;
+        }
+
+        case MAVLINK_MSG_ID_PING: {
+            mavlink_ping_t ping;
+            mavlink_msg_ping_decode(request, &ping);
+            if (ping.target_system != 0 || !isOwnSystem(0)) return 0;
+            ping.target_system = request->sysid;
+            ping.target_component = request->compid;
+            return wireStruct(mavBuffer, 1, MAVLINK_MSG_ID_PING, &ping,
+                MAVLINK_MSG_ID_PING_LEN, MAVLINK_MSG_ID_PING_CRC);
+        }
+
+        case MAVLINK_MSG_ID_TIMESYNC: {
+            mavlink_timesync_t timesync;
+            mavlink_msg_timesync_decode(request, &timesync);
+            if (timesync.tc1 != 0 || !isOwnSystem(timesync.target_system)) return 0;
+            timesync.tc1 = esp_timer_get_time() * 1000;     // 64-bit, micros() wraps after 71 min
+            timesync.target_system = request->sysid;
+            timesync.target_component = request->compid;
+            return wireStruct(mavBuffer, 1, MAVLINK_MSG_ID_TIMESYNC, &timesync,
+                MAVLINK_MSG_ID_TIMESYNC_LEN, MAVLINK_MSG_ID_TIMESYNC_CRC);
+        }
+
+        case MAVLINK_MSG_ID_PARAM_REQUEST_LIST: {
+            mavlink_param_request_list_t list;
+            mavlink_msg_param_request_list_decode(request, &list);
+            if (!isOwnSystem(list.target_system)) return 0;
+
+            // The bridge has no parameters: report an empty list
+            mavlink_param_value_t value = {};
+            value.param_count = 0;
+            value.param_index = 0;
+            value.param_type = MAV_PARAM_TYPE_REAL32;
+            return wireStruct(mavBuffer, list.target_system ? list.target_system : 1, MAVLINK_MSG_ID_PARAM_VALUE, &value,
+                MAVLINK_MSG_ID_PARAM_VALUE_LEN, MAVLINK_MSG_ID_PARAM_VALUE_CRC);
+        }
+    }
+    return 0;
+}
+
+void resetMAVLinkUplink(int peer) {
+    memset(&rxMessage[peer], 0, sizeof(mavlink_message_t));
+    memset(&rxStatus[peer], 0, sizeof(mavlink_status_t));
+}
+
+// GCS uplink of one peer: applies the rate requests and answers the cheap
+// requests locally. Returns the length of the replies written to replyBuffer.
+uint16_t handleMAVLinkUplink(int peer, const uint8_t* data, int len, uint8_t* replyBuffer, uint16_t replySize) {
+    mavlink_message_t request;
+    mavlink_status_t status;
+    uint16_t replyLength = 0;
+
+    for (int i = 0; i < len; i++) {
+        if (mavlink_frame_char_buffer(&rxMessage[peer], &rxStatus[peer], data[i], &request, &status) != MAVLINK_FRAMING_OK) continue;
+
+        // Room for a reply and its COMMAND_ACK
+        if (replyLength + 2 * MAVLINK_MAX_PACKET_LEN > replySize) continue;
+        replyLength += handleGCSMessage(&request, replyBuffer + replyLength);
+    }
+    return replyLength;
+}
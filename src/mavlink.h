@@ -2,5 +2,8 @@
 #define _MAVLINK_H_
 #include <Arduino.h>
 struct TelemetryData_t;
-bool buildMAVLinkDataStream(TelemetryData_t* telemetry, uint8_t** ptrMavlinkData, uint16_t* ptrDataLength);
+uint16_t mavlinkStreamMaxLength(uint32_t messages);
+uint16_t buildMAVLinkDataStream(TelemetryData_t* telemetry, uint8_t systemId, uint32_t messages, uint8_t* mavBuffer);
+void resetMAVLinkUplink(int peer);
+uint16_t handleMAVLinkUplink(int peer, const uint8_t* data, int len, uint8_t* replyBuffer, uint16_t replySize);
 #endif
\ No newline at end of file
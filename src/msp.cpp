@@ -0,0 +1,49 @@
+#include "msp.h"
+#include "crc.h"
+#include "crsf.h"
+
+// Handler for the payload of one MSP function, returns the count of decoded items
+typedef int (*MSPHandler_t)(const uint8_t* payload, int size, TelemetryData_t* telemetry);
+
+typedef struct {
+    uint16_t function;
+    MSPHandler_t handler;
+} MSPHandlerEntry_t;
+
+static const MSPHandlerEntry_t mspHandlers[] = {
+    { MSP_ELRS_BACKPACK_CRSF_TLM, parseCRSFPacket },
+};
+
+// Envelope check: sync bytes, size field and DVB-S2 checksum
+bool IRAM_ATTR mspV2Decode(const uint8_t* data, int len, MSPv2Frame_t* frame) {
+    if (len < MSP_V2_MIN_LEN) return false;
+    if (data[0] != 0x24 || data[1] != 0x58 || data[2] != 0x3C) return false;
+
+    uint16_t size = data[6] | (data[7] << 8);
+    if (MSP_V2_HEADER_LEN + size + 1 > len) return false;
+
+    // Checksum covers flag, function, size and payload
+    uint8_t crc = crc8DvbS2(0, data + 3, MSP_V2_HEADER_LEN - 3 + size);
+    if (crc != data[MSP_V2_HEADER_LEN + size]) return false;
+
+    if (frame) {
+        frame->flag = data[3];
+        frame->function = data[4] | (data[5] << 8);
+        frame->size = size;
+        frame->payload = data + MSP_V2_HEADER_LEN;
+    }
+    return true;
+}
+
+// Data parser: decodes the envelope and routes the payload by function ID
+int parseMSPPacket(const uint8_t* data, int len, TelemetryData_t* telemetry) {
+    MSPv2Frame_t frame;
+    if (!mspV2Decode(data, len, &frame)) return 0;
+
+    for (size_t i = 0; i < sizeof(mspHandlers) / sizeof(mspHandlers[0]); i++) {
+        if (mspHandlers[i].function == frame.function) {
+            return mspHandlers[i].handler(frame.payload, frame.size, telemetry);
+        }
+    }
+    return 0;
+}
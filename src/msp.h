@@ -0,0 +1,23 @@
+#ifndef _MSP_H_
+#define _MSP_H_
+#include <Arduino.h>
+
+// MSP v2 function IDs sent by the ELRS backpack
+#define MSP_ELRS_BACKPACK_CRSF_TLM  0x0011
+
+#define MSP_V2_HEADER_LEN   8   // '$' 'X' '<' flag function(2) size(2)
+#define MSP_V2_MIN_LEN      (MSP_V2_HEADER_LEN + 1)
+
+struct TelemetryData_t;
+
+// Decoded MSP v2 envelope, payload points into the source buffer
+struct MSPv2Frame_t {
+    uint8_t flag;
+    uint16_t function;
+    uint16_t size;
+    const uint8_t* payload;
+};
+
+bool mspV2Decode(const uint8_t* data, int len, MSPv2Frame_t* frame);
+int parseMSPPacket(const uint8_t* data, int len, TelemetryData_t* telemetry);
+#endif
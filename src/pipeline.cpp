@@ -0,0 +1,160 @@
+#include "pipeline.h"
+#include "msp.h"
+#include "mavlink.h"
+#include "vehicles.h"
+#include "scheduler.h"
+#include "trace.h"
+#include "health.h"
+
+// ESPNow data header, the frame bytes follow it in the packet buffer
+typedef struct {
+    uint32_t timestamp;     // received [us]
+    uint32_t enqueued;      // [us], for the latency trace
+    uint16_t len;
+    uint8_t mac[6];     // sender
+} ESPNowPacket;
+
+static uint8_t packetStorage[PACKET_BUFFER_SIZE] __attribute__((aligned(4)));
+RingBuffer_t packetBuffer;
+DatagramBatcher_t udpBatcher;
+volatile uint32_t receivedPackets = 0;
+volatile uint32_t rejectedPackets = 0;
+volatile uint32_t timedOutPackets = 0;
+static DatagramSend_t datagramSend;
+
+// Every datagram goes out here, so the frames it carries are traced as sent
+static void sendTraced(const uint8_t* data, uint16_t length) {
+    datagramSend(data, length);
+    traceSent();
+}
+
+bool pipelineInit(DatagramSend_t send) {
+    datagramSend = send;
+    schedulerReset();
+    batcherInit(&udpBatcher, sendTraced);
+    return ringBufferInit(&packetBuffer, packetStorage, PACKET_BUFFER_SIZE);
+}
+
+bool IRAM_ATTR pipelinePush(const uint8_t* mac, const uint8_t* data, int len) {
+    uint32_t received = micros();
+    receivedPackets++;
+
+    // Fast data checking
+    if (len > MAX_ESPNOW_PAYLOAD) {
+        rejectedPackets++;
+        return false;
+    }
+
+    // MSP v2 envelope checking
+    if (!mspV2Decode(data, len, NULL)) {
+        rejectedPackets++;
+        return false;
+    }
+
+    // Write packet in place, drop it if the buffer is full
+    uint8_t* slot = ringBufferReserve(&packetBuffer, sizeof(ESPNowPacket) + len);
+    if (slot == NULL) return false;
+
+    ESPNowPacket* packet = (ESPNowPacket*)slot;
+    packet->timestamp = received;
+    packet->len = len;
+    memcpy(packet->mac, mac, 6);
+    memcpy(slot + sizeof(ESPNowPacket), data, len);
+    packet->enqueued = micros();
+    ringBufferCommit(&packetBuffer);
+    return true;
+}
+
+// Build the selected MAVLink messages straight into the outgoing datagram
+static void sendVehicleStream(Vehicle_t* vehicle, uint32_t messages) {
+    uint8_t* mavBuffer = batcherReserve(&udpBatcher, mavlinkStreamMaxLength(messages), micros());
+    batcherCommit(&udpBatcher, buildMAVLinkDataStream(&vehicle->telemetry, vehicle->systemId, messages, mavBuffer));
+}
+
+uint32_t pipelineDrain() {
+    uint32_t drained = 0;
+
+    const ESPNowPacket* packet;
+    while ((packet = (const ESPNowPacket*)ringBufferPeek(&packetBuffer, NULL)) != NULL) {
+        TraceRecord_t* trace = traceBegin(packet->timestamp, packet->enqueued, packet->len);
+        bool held = false;
+
+        // Check timeout
+        if ((micros() - packet->timestamp) / 1000 <= PACKET_TIMEOUT_MS) {
+            // Parse MSP data straight from the packet buffer into the sender state
+            Vehicle_t* vehicle = vehicleLookup(packet->mac);
+            if (vehicle != NULL) {
+                vehicleWriteBegin(vehicle);
+                parseMSPPacket((const uint8_t*)(packet + 1), packet->len, &vehicle->telemetry);
+                vehicleWriteEnd(vehicle);
+                traceStamp(trace, TRACE_PARSED);
+                drained++;
+#ifdef MAVLINK_EVENT_DRIVEN
+                // Send the affected messages now if their rate allows it
+                if (vehicle->telemetry.updated) {
+                    uint32_t messages = schedulerOnUpdate(&vehicle->schedule, vehicle->telemetry.updated, millis());
+                    vehicle->telemetry.updated = 0;
+                    if (messages) {
+                        sendVehicleStream(vehicle, messages);
+                        traceStamp(trace, TRACE_ENCODED);
+                        traceHold(trace);
+                        held = true;
+                    }
+                }
+#endif
+            }
+        } else {
+            timedOutPackets++;
+        }
+        if (!held) {
+            traceEnd(trace);
+        }
+        ringBufferRelease(&packetBuffer);
+
+        // Long bursts: do not hold the datagram past its deadline
+        batcherPoll(&udpBatcher, micros(), false);
+    }
+    return drained;
+}
+
+void pipelineSendScheduled() {
+#ifdef MAVLINK_EVENT_DRIVEN
+    const bool keepAlive = false;
+#else
+    const bool keepAlive = true;
+#endif
+
+    // Scheduled messages of every vehicle under its own system ID
+    uint32_t now = millis();
+    healthUpdate(now);
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        Vehicle_t* vehicle = vehicleAt(i);
+        if (vehicle == NULL) continue;
+
+        uint32_t messages = 0;
+        int slot;
+        while ((slot = schedulerPopDue(&vehicle->schedule, now, keepAlive)) >= 0) {
+            messages |= SCHEDULED_BIT(slot);
+        }
+        if (messages) {
+            sendVehicleStream(vehicle, messages);
+        }
+    }
+
+    // Nothing more pending: send what is batched
+    batcherPoll(&udpBatcher, micros(), true);
+}
+
+uint32_t pipelineNextWakeup(uint32_t maxWait) {
+    uint32_t now = millis();
+    uint32_t wait = maxWait;
+
+    for (int i = 0; i < MAX_VEHICLES; i++) {
+        Vehicle_t* vehicle = vehicleAt(i);
+        if (vehicle == NULL) continue;
+        int32_t due = (int32_t)(schedulerNextDue(&vehicle->schedule) - now);
+        if (due <= 0) return 0;
+        if ((uint32_t)due < wait) wait = due;
+    }
+    return wait;
+}
@@ -0,0 +1,37 @@
+#ifndef _PIPELINE_H_
+#define _PIPELINE_H_
+#include <Arduino.h>
+#include "ring-buffer.h"
+#include "batcher.h"
+
+// ESP-NOW frames to MAVLink datagrams, without the WiFi and task plumbing,
+// so the same code runs on the ESP32 and in the host build
+
+// Config
+#define PACKET_BUFFER_SIZE 4096  // bytes, frames are stored back-to-back
+#define PACKET_TIMEOUT_MS 200
+#define MAX_ESPNOW_PAYLOAD 300
+
+// Send MAVLink messages as soon as the CRSF frames are decoded (limited by the
+// message rates), comment out to re-send every message at its rate
+#define MAVLINK_EVENT_DRIVEN
+
+extern RingBuffer_t packetBuffer;
+extern DatagramBatcher_t udpBatcher;
+// Ingest counters, written by one task each
+extern volatile uint32_t receivedPackets;   // ESP-NOW callback calls
+extern volatile uint32_t rejectedPackets;   // too long or bad MSP envelope
+extern volatile uint32_t timedOutPackets;   // older than PACKET_TIMEOUT_MS when dequeued
+
+bool pipelineInit(DatagramSend_t send);
+// Receive side, safe in the ESP-NOW callback: checks the MSP envelope and
+// queues the frame. Returns false if it was dropped.
+bool pipelinePush(const uint8_t* mac, const uint8_t* data, int len);
+// Parses all queued frames, returns how many were parsed
+uint32_t pipelineDrain();
+// Sends the messages due by the vehicle schedules, then flushes the batch.
+// Also updates the bridge health.
+void pipelineSendScheduled();
+// Time until the next scheduled message [ms], at most maxWait
+uint32_t pipelineNextWakeup(uint32_t maxWait);
+#endif
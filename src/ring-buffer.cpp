@@ -0,0 +1,96 @@
+#include "ring-buffer.h"
+
+#define RING_RECORD_HEADER_LEN  4
+#define RING_WRAP_MARKER        0xFFFFFFFF
+
+static inline uint32_t alignRecord(uint32_t len) {
+    return (len + 3) & ~3u;
+}
+
+static inline uint32_t loadAcquire(const volatile uint32_t* ptr) {
+    return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+static inline void storeRelease(volatile uint32_t* ptr, uint32_t value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+bool ringBufferInit(RingBuffer_t* rb, uint8_t* storage, uint32_t size) {
+    if (storage == NULL || size < 16 || (size & (size - 1)) != 0) return false;
+    if (((uintptr_t)storage & 3) != 0) return false;
+
+    rb->buffer = storage;
+    rb->size = size;
+    rb->mask = size - 1;
+    rb->head = 0;
+    rb->tail = 0;
+    rb->reserveHead = 0;
+    rb->readLength = 0;
+    rb->overflowCount = 0;
+    return true;
+}
+
+// Returns the place to write len bytes, or NULL if the ring is full.
+// Nothing is visible to the consumer until ringBufferCommit is called.
+uint8_t* IRAM_ATTR ringBufferReserve(RingBuffer_t* rb, uint32_t len) {
+    uint32_t need = RING_RECORD_HEADER_LEN + alignRecord(len);
+    uint32_t head = rb->head;
+    uint32_t freeSpace = rb->size - (head - loadAcquire(&rb->tail));
+    uint32_t offset = head & rb->mask;
+    uint32_t contiguous = rb->size - offset;
+
+    if (need > contiguous) {
+        // Record does not fit before the end: skip the tail of the storage
+        if (need + contiguous > freeSpace) {
+            rb->overflowCount++;
+            return NULL;
+        }
+        *(uint32_t*)(rb->buffer + offset) = RING_WRAP_MARKER;
+        head += contiguous;
+        offset = 0;
+    } else if (need > freeSpace) {
+        rb->overflowCount++;
+        return NULL;
+    }
+
+    *(uint32_t*)(rb->buffer + offset) = len;
+    rb->reserveHead = head + need;
+    return rb->buffer + offset + RING_RECORD_HEADER_LEN;
+}
+
+void IRAM_ATTR ringBufferCommit(RingBuffer_t* rb) {
+    storeRelease(&rb->head, rb->reserveHead);
+}
+
+// Returns the oldest record in place, or NULL if the ring is empty.
+// The record stays valid until ringBufferRelease is called.
+const uint8_t* ringBufferPeek(RingBuffer_t* rb, uint32_t* len) {
+    uint32_t tail = rb->tail;
+    uint32_t head = loadAcquire(&rb->head);
+    if (tail == head) return NULL;
+
+    uint32_t offset = tail & rb->mask;
+    uint32_t recordLen = *(const uint32_t*)(rb->buffer + offset);
+    if (recordLen == RING_WRAP_MARKER) {
+        tail += rb->size - offset;
+        storeRelease(&rb->tail, tail);
+        if (tail == head) return NULL;
+        offset = 0;
+        recordLen = *(const uint32_t*)rb->buffer;
+    }
+
+    rb->readLength = recordLen;
+    if (len) {
+        *len = recordLen;
+    }
+    return rb->buffer + offset + RING_RECORD_HEADER_LEN;
+}
+
+void ringBufferRelease(RingBuffer_t* rb) {
+    storeRelease(&rb->tail, rb->tail + RING_RECORD_HEADER_LEN + alignRecord(rb->readLength));
+    rb->readLength = 0;
+}
+
+uint32_t ringBufferUsed(const RingBuffer_t* rb) {
+    return loadAcquire(&rb->head) - loadAcquire(&rb->tail);
+}
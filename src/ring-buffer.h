@@ -0,0 +1,36 @@
+#ifndef _RING_BUFFER_H_
+#define _RING_BUFFER_H_
+#include <Arduino.h>
+
+// Lock-free single-producer / single-consumer byte ring.
+// Records of variable length are stored back-to-back, each one prefixed with
+// a 4-byte length word. A record is never split: if it does not fit before the
+// end of the storage, a wrap marker is written and the record starts at offset 0.
+// The producer writes in place (reserve + commit), the consumer reads in place
+// (peek + release), so no intermediate copies are needed.
+struct RingBuffer_t {
+    uint8_t* buffer;
+    uint32_t size;              // power of two
+    uint32_t mask;
+    volatile uint32_t head;     // published write position (free running)
+    volatile uint32_t tail;     // published read position (free running)
+    uint32_t reserveHead;       // producer private: head after the reserved record
+    uint32_t readLength;        // consumer private: length of the peeked record
+    volatile uint32_t overflowCount;
+};
+
+// storage must be 4-byte aligned and size a power of two
+bool ringBufferInit(RingBuffer_t* rb, uint8_t* storage, uint32_t size);
+
+// Producer side
+uint8_t* ringBufferReserve(RingBuffer_t* rb, uint32_t len);
+void ringBufferCommit(RingBuffer_t* rb);
+
+// Consumer side
+const uint8_t* ringBufferPeek(RingBuffer_t* rb, uint32_t* len);
+void ringBufferRelease(RingBuffer_t* rb);
+
+// Bytes currently in use (approximate when called from a third context)
+uint32_t ringBufferUsed(const RingBuffer_t* rb);
+
+#endif
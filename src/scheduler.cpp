@@ -0,0 +1,218 @@
+#include "scheduler.h"
+#include "crsf.h"
+#include "pipeline.h"
+#include "common/mavlink.h"
+
+// Idle slots are checked again after this time
+#define SCHEDULER_PARK_MS   1000
+
+typedef struct {
+    uint32_t msgId;
+    uint32_t group;             // TELEMETRY_* group the message is built from
+    uint8_t dataStream;         // MAV_DATA_STREAM the message belongs to
+    int32_t defaultIntervalMs;  // 0: on arrival, without a rate limit
+} ScheduledMessageInfo_t;
+
+// Event-driven ATTITUDE goes out with every frame, as fast as ELRS sends it.
+// The periodic stream has no arrivals to follow, so it keeps a 10 Hz rate.
+#ifdef MAVLINK_EVENT_DRIVEN
+#define ATTITUDE_INTERVAL_MS    0
+#else
+#define ATTITUDE_INTERVAL_MS    100
+#endif
+
+static const ScheduledMessageInfo_t scheduledMessages[SCHEDULED_MESSAGES] = {
+    { MAVLINK_MSG_ID_HEARTBEAT,           TELEMETRY_FLIGHT_MODE, MAV_DATA_STREAM_ALL,             1000 },
+    { MAVLINK_MSG_ID_SYS_STATUS,          TELEMETRY_BATTERY,     MAV_DATA_STREAM_EXTENDED_STATUS, 500 },
+    { MAVLINK_MSG_ID_GPS_RAW_INT,         TELEMETRY_GPS,         MAV_DATA_STREAM_EXTENDED_STATUS, 200 },
+    { MAVLINK_MSG_ID_GLOBAL_POSITION_INT, TELEMETRY_GPS,         MAV_DATA_STREAM_POSITION,        200 },
+    { MAVLINK_MSG_ID_ATTITUDE,            TELEMETRY_ATTITUDE,    MAV_DATA_STREAM_EXTRA1,          ATTITUDE_INTERVAL_MS },
+};
+
+// Intervals shared by all vehicles, < 0: disabled, set by schedulerReset
+static int32_t intervalMs[SCHEDULED_MESSAGES];
+static uint32_t intervalGeneration = 0;
+
+static int findSlot(uint32_t msgId) {
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        if (scheduledMessages[slot].msgId == msgId) return slot;
+    }
+    return -1;
+}
+
+// Sent at their rate even without new data: the link and the bridge health
+static inline bool isKeepAlive(int slot) {
+    return slot == SCHEDULED_HEARTBEAT || slot == SCHEDULED_SYS_STATUS;
+}
+
+static inline bool isEarlier(const MessageSchedule_t* schedule, int a, int b) {
+    return (int32_t)(schedule->nextDue[schedule->heap[a]] - schedule->nextDue[schedule->heap[b]]) < 0;
+}
+
+static void heapSwap(MessageSchedule_t* schedule, int a, int b) {
+    uint8_t slot = schedule->heap[a];
+    schedule->heap[a] = schedule->heap[b];
+    schedule->heap[b] = slot;
+    schedule->position[schedule->heap[a]] = a;
+    schedule->position[schedule->heap[b]] = b;
+}
+
+// Restores the heap order after the due time of a slot has changed
+static void heapFix(MessageSchedule_t* schedule, int slot) {
+    int index = schedule->position[slot];
+
+    while (index > 0 && isEarlier(schedule, index, (index - 1) / 2)) {
+        heapSwap(schedule, index, (index - 1) / 2);
+        index = (index - 1) / 2;
+    }
+
+    while (true) {
+        int smallest = index;
+        int left = 2 * index + 1;
+        int right = left + 1;
+        if (left < SCHEDULED_MESSAGES && isEarlier(schedule, left, smallest)) smallest = left;
+        if (right < SCHEDULED_MESSAGES && isEarlier(schedule, right, smallest)) smallest = right;
+        if (smallest == index) break;
+        heapSwap(schedule, index, smallest);
+        index = smallest;
+    }
+}
+
+static void reschedule(MessageSchedule_t* schedule, int slot, uint32_t due) {
+    schedule->nextDue[slot] = due;
+    heapFix(schedule, slot);
+}
+
+// Slots sent on arrival have no due time of their own
+static inline uint32_t nextDueAfter(int slot, uint32_t sent) {
+    return sent + (intervalMs[slot] > 0 ? intervalMs[slot] : SCHEDULER_PARK_MS);
+}
+
+void schedulerReset() {
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        intervalMs[slot] = scheduledMessages[slot].defaultIntervalMs;
+    }
+    intervalGeneration++;
+}
+
+// Intervals were changed by the GCS: every slot is due now
+static void checkGeneration(MessageSchedule_t* schedule, uint32_t now) {
+    if (schedule->generation == intervalGeneration) return;
+
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        schedule->heap[slot] = slot;
+        schedule->position[slot] = slot;
+        schedule->nextDue[slot] = now;
+        schedule->lastSent[slot] = now - SCHEDULER_PARK_MS * 60;
+    }
+    schedule->generation = intervalGeneration;
+}
+
+void schedulerInit(MessageSchedule_t* schedule, uint32_t now) {
+    schedule->pending = 0;
+    schedule->generation = intervalGeneration - 1;
+    checkGeneration(schedule, now);
+}
+
+int schedulerPopDue(MessageSchedule_t* schedule, uint32_t now, bool keepAlive) {
+    checkGeneration(schedule, now);
+
+    while ((int32_t)(now - schedulerNextDue(schedule)) >= 0) {
+        int slot = schedule->heap[0];
+        bool send = intervalMs[slot] >= 0 &&
+                    (keepAlive || isKeepAlive(slot) || (schedule->pending & SCHEDULED_BIT(slot)));
+
+        if (send) {
+            schedule->lastSent[slot] = now;
+            schedule->pending &= ~SCHEDULED_BIT(slot);
+            reschedule(schedule, slot, nextDueAfter(slot, now));
+            return slot;
+        }
+
+        // Nothing new for this slot, park it until the next update
+        reschedule(schedule, slot, now + SCHEDULER_PARK_MS);
+    }
+    return -1;
+}
+
+uint32_t schedulerNextDue(const MessageSchedule_t* schedule) {
+    return schedule->nextDue[schedule->heap[0]];
+}
+
+uint32_t schedulerOnUpdate(MessageSchedule_t* schedule, uint32_t groups, uint32_t now) {
+    uint32_t allowed = 0;
+    checkGeneration(schedule, now);
+
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        if (!(scheduledMessages[slot].group & groups) || intervalMs[slot] < 0) continue;
+
+        if ((int32_t)(now - schedule->lastSent[slot]) >= intervalMs[slot]) {
+            // Rate allows it: send right away
+            allowed |= SCHEDULED_BIT(slot);
+            schedule->lastSent[slot] = now;
+            schedule->pending &= ~SCHEDULED_BIT(slot);
+            reschedule(schedule, slot, nextDueAfter(slot, now));
+        } else {
+            // Too early: send the newest data when the slot is due
+            schedule->pending |= SCHEDULED_BIT(slot);
+            reschedule(schedule, slot, schedule->lastSent[slot] + intervalMs[slot]);
+        }
+    }
+    return allowed;
+}
+
+uint32_t schedulerMessageId(int slot) {
+    return scheduledMessages[slot].msgId;
+}
+
+uint32_t schedulerMessagesOf(uint32_t groups) {
+    uint32_t messages = 0;
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        if (scheduledMessages[slot].group & groups) {
+            messages |= SCHEDULED_BIT(slot);
+        }
+    }
+    return messages;
+}
+
+// MAV_CMD_SET_MESSAGE_INTERVAL: -1 disables, 0 restores the default
+bool schedulerSetMessageInterval(uint32_t msgId, int32_t intervalUs) {
+    int slot = findSlot(msgId);
+    if (slot < 0) return false;
+
+    if (intervalUs < 0) {
+        intervalMs[slot] = -1;
+    } else if (intervalUs == 0) {
+        intervalMs[slot] = scheduledMessages[slot].defaultIntervalMs;
+    } else {
+        intervalMs[slot] = intervalUs / 1000 > 0 ? intervalUs / 1000 : 1;
+    }
+    intervalGeneration++;
+    return true;
+}
+
+// MAV_CMD_GET_MESSAGE_INTERVAL: in microseconds, -1 if disabled, 0 if not supported.
+// On arrival is reported as the finest interval of the scheduler, 1 ms.
+int32_t schedulerGetMessageInterval(uint32_t msgId) {
+    int slot = findSlot(msgId);
+    if (slot < 0) return 0;
+    if (intervalMs[slot] < 0) return -1;
+    return intervalMs[slot] > 0 ? intervalMs[slot] * 1000 : 1000;
+}
+
+// REQUEST_DATA_STREAM (deprecated but still used by many GCS)
+void schedulerRequestDataStream(uint8_t streamId, uint16_t rateHz, bool start) {
+    for (int slot = 0; slot < SCHEDULED_MESSAGES; slot++) {
+        if (slot == SCHEDULED_HEARTBEAT) continue;
+        if (streamId != MAV_DATA_STREAM_ALL && scheduledMessages[slot].dataStream != streamId) continue;
+
+        if (!start) {
+            intervalMs[slot] = -1;
+        } else if (rateHz == 0) {
+            intervalMs[slot] = scheduledMessages[slot].defaultIntervalMs;
+        } else {
+            intervalMs[slot] = rateHz <= 1000 ? 1000 / rateHz : 1;
+        }
+    }
+    intervalGeneration++;
+}
@@ -0,0 +1,49 @@
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+#include <Arduino.h>
+
+// MAVLink messages sent by the bridge, one scheduler slot each
+typedef enum {
+    SCHEDULED_HEARTBEAT = 0,
+    SCHEDULED_SYS_STATUS,
+    SCHEDULED_GPS_RAW_INT,
+    SCHEDULED_GLOBAL_POSITION_INT,
+    SCHEDULED_ATTITUDE,
+    SCHEDULED_MESSAGES
+} ScheduledMessage_e;
+
+#define SCHEDULED_BIT(slot) (1u << (slot))
+
+// Per-vehicle schedule: min-heap of slots ordered by their next due time
+struct MessageSchedule_t {
+    uint8_t heap[SCHEDULED_MESSAGES];
+    uint8_t position[SCHEDULED_MESSAGES];   // heap index of every slot
+    uint32_t nextDue[SCHEDULED_MESSAGES];   // ms
+    uint32_t lastSent[SCHEDULED_MESSAGES];  // ms
+    uint32_t pending;                       // slots with new data waiting for their turn
+    uint32_t generation;                    // interval table version the heap was built for
+};
+
+// Default intervals of all messages, before the first vehicle
+void schedulerReset();
+void schedulerInit(MessageSchedule_t* schedule, uint32_t now);
+
+// Returns the next slot due at 'now' (-1 if none) and reschedules it.
+// keepAlive: re-send slots without new data (periodic stream).
+int schedulerPopDue(MessageSchedule_t* schedule, uint32_t now, bool keepAlive);
+
+// Time of the earliest due slot, O(1)
+uint32_t schedulerNextDue(const MessageSchedule_t* schedule);
+
+// New data for the slots of the decoded telemetry groups.
+// Returns the slots allowed to be sent right now, the others stay pending.
+uint32_t schedulerOnUpdate(MessageSchedule_t* schedule, uint32_t groups, uint32_t now);
+
+// GCS requests
+uint32_t schedulerMessageId(int slot);
+// Messages built from the given TELEMETRY_* groups
+uint32_t schedulerMessagesOf(uint32_t groups);
+bool schedulerSetMessageInterval(uint32_t msgId, int32_t intervalUs);
+int32_t schedulerGetMessageInterval(uint32_t msgId);
+void schedulerRequestDataStream(uint8_t streamId, uint16_t rateHz, bool start);
+#endif
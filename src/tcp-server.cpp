@@ -0,0 +1,120 @@
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include "tcp-server.h"
+#include "config.h"
+
+struct TCPClient_t {
+    bool used;
+    WiFiClient client;
+    uint32_t cursor;        // position in the shared stream
+    uint32_t skipped;       // bytes lost because the client was too slow
+};
+
+static WiFiServer tcpServer(TCP_PORT);
+static TCPClient_t clients[MAX_TCP_CLIENTS];
+
+// Shared stream: written once, every client reads with its own cursor
+static uint8_t streamBuffer[TCP_STREAM_BUFFER_SIZE];
+static uint32_t streamHead = 0;     // free running
+
+void tcpServerSetup() {
+    tcpServer.begin();
+    tcpServer.setNoDelay(true);
+    Serial.printf("MAVLink TCP server on port %d\n", TCP_PORT);
+}
+
+void tcpServerWrite(const uint8_t* data, uint16_t length) {
+    if (tcpClientCount() == 0) return;
+
+    uint32_t offset = streamHead & (TCP_STREAM_BUFFER_SIZE - 1);
+    uint32_t first = TCP_STREAM_BUFFER_SIZE - offset;
+    if (first > length) first = length;
+
+    memcpy(streamBuffer + offset, data, first);
+    memcpy(streamBuffer, data + first, length - first);
+    streamHead += length;
+}
+
+static void acceptClients() {
+    WiFiClient newClient = tcpServer.available();
+    if (!newClient) return;
+
+    for (int i = 0; i < MAX_TCP_CLIENTS; i++) {
+        if (!clients[i].used) {
+            clients[i].client = newClient;
+            clients[i].client.setNoDelay(true);
+            clients[i].cursor = streamHead;
+            clients[i].skipped = 0;
+            clients[i].used = true;
+            Serial.printf("TCP client %d connected\n", i);
+            return;
+        }
+    }
+    // No room
+    newClient.stop();
+}
+
+static void dropClient(TCPClient_t* client) {
+    client->client.stop();
+    client->used = false;
+}
+
+// Sends as much as the socket takes right now, never waits
+static void pushClient(TCPClient_t* client) {
+    uint32_t pending = streamHead - client->cursor;
+
+    // Overrun by the writer: skip ahead to the live data
+    if (pending > TCP_STREAM_BUFFER_SIZE) {
+        client->skipped += pending;
+        client->cursor = streamHead;
+        return;
+    }
+
+    int fd = client->client.fd();
+    while (pending > 0) {
+        uint32_t offset = client->cursor & (TCP_STREAM_BUFFER_SIZE - 1);
+        uint32_t chunk = TCP_STREAM_BUFFER_SIZE - offset;
+        if (chunk > pending) chunk = pending;
+
+        int sent = send(fd, streamBuffer + offset, chunk, MSG_DONTWAIT);
+        if (sent < 0) {
+            if (errno != EWOULDBLOCK && errno != EAGAIN) {
+                dropClient(client);
+            }
+            return;
+        }
+        client->cursor += sent;
+        pending -= sent;
+        if ((uint32_t)sent < chunk) return;
+    }
+}
+
+void tcpServerRun() {
+    acceptClients();
+
+    for (int i = 0; i < MAX_TCP_CLIENTS; i++) {
+        TCPClient_t* client = &clients[i];
+        if (!client->used) continue;
+
+        if (!client->client.connected()) {
+            dropClient(client);
+            continue;
+        }
+
+        // Uplink over TCP is not handled, discard it
+        while (client->client.available() > 0) {
+            uint8_t discard[64];
+            client->client.read(discard, sizeof(discard));
+        }
+
+        pushClient(client);
+    }
+}
+
+int tcpClientCount() {
+    int count = 0;
+    for (int i = 0; i < MAX_TCP_CLIENTS; i++) {
+        if (clients[i].used) count++;
+    }
+    return count;
+}
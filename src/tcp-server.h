@@ -0,0 +1,14 @@
+#ifndef _TCP_SERVER_H_
+#define _TCP_SERVER_H_
+#include <Arduino.h>
+
+#define MAX_TCP_CLIENTS         4
+#define TCP_STREAM_BUFFER_SIZE  8192    // shared by all clients, power of two
+
+void tcpServerSetup();
+// Appends encoded MAVLink bytes to the stream shared by all clients
+void tcpServerWrite(const uint8_t* data, uint16_t length);
+// Accepts clients and pushes the stream without blocking
+void tcpServerRun();
+int tcpClientCount();
+#endif
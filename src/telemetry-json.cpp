@@ -0,0 +1,88 @@
+#include <stdarg.h>
+#include "telemetry-json.h"
+
+struct JsonWriter_t {
+    char* buffer;
+    int size;
+    int length;
+    bool overflow;
+};
+
+static void jsonAppend(JsonWriter_t* writer, const char* format, ...) {
+    if (writer->overflow) return;
+
+    va_list args;
+    va_start(args, format);
+    int room = writer->size - writer->length;
+    int written = vsnprintf(writer->buffer + writer->length, room, format, args);
+    va_end(args);
+
+    if (written < 0 || written >= room) {
+        writer->overflow = true;
+        return;
+    }
+    writer->length += written;
+}
+
+// Flight mode comes from the link, escape it
+static void jsonAppendString(JsonWriter_t* writer, const char* text) {
+    jsonAppend(writer, "\"");
+    for (; *text; text++) {
+        uint8_t c = *text;
+        if (c == '"' || c == '\\') {
+            jsonAppend(writer, "\\%c", c);
+        } else if (c < 0x20) {
+            jsonAppend(writer, "\\u%04x", c);
+        } else {
+            jsonAppend(writer, "%c", c);
+        }
+    }
+    jsonAppend(writer, "\"");
+}
+
+int telemetryToJson(const TelemetryData_t* telemetry, uint8_t systemId, const uint8_t* mac,
+                    uint32_t groups, char* buffer, int size) {
+    JsonWriter_t writer = {buffer, size, 0, false};
+
+    jsonAppend(&writer, "{\"system_id\":%u,\"mac\":\"%02X:%02X:%02X:%02X:%02X:%02X\",\"age_ms\":%lu",
+               systemId, mac[0], mac[1], mac[2], mac[3], mac[4], mac[5],
+               (unsigned long)(millis() - telemetry->lastUpdate));
+
+    if ((groups & TELEMETRY_BATTERY) && telemetry->battery.enabled) {
+        jsonAppend(&writer, ",\"battery\":{\"voltage\":%.1f,\"current\":%.1f,\"capacity\":%lu,\"remaining\":%u}",
+                   telemetry->battery.voltage, telemetry->battery.current,
+                   (unsigned long)telemetry->battery.capacity, telemetry->battery.remaining);
+    }
+    if ((groups & TELEMETRY_ATTITUDE) && telemetry->attitude.enabled) {
+        jsonAppend(&writer, ",\"attitude\":{\"pitch\":%.4f,\"roll\":%.4f,\"yaw\":%.4f}",
+                   telemetry->attitude.pitch, telemetry->attitude.roll, telemetry->attitude.yaw);
+    }
+    if ((groups & TELEMETRY_GPS) && telemetry->gps.enabled) {
+        jsonAppend(&writer, ",\"gps\":{\"latitude\":%.7f,\"longitude\":%.7f,\"altitude\":%.1f,"
+                   "\"ground_speed\":%.1f,\"heading\":%.2f,\"satellites\":%u}",
+                   telemetry->gps.latitude, telemetry->gps.longitude, telemetry->gps.altitude,
+                   telemetry->gps.groundSpeed, telemetry->gps.heading, telemetry->gps.satellites);
+    }
+    if ((groups & TELEMETRY_FLIGHT_MODE) && telemetry->flightMode.enabled) {
+        jsonAppend(&writer, ",\"flight_mode\":");
+        jsonAppendString(&writer, telemetry->flightMode.mode);
+    }
+
+    if (groups & TELEMETRY_JSON_STATISTIC) {
+        // Only the frame types seen so far
+        jsonAppend(&writer, ",\"statistic\":{\"packets\":%lu,\"crc_errors\":%lu,\"frames\":{",
+                   (unsigned long)telemetry->statistic.packetCount,
+                   (unsigned long)telemetry->statistic.crcErrors);
+        bool first = true;
+        for (int type = 0; type < 256; type++) {
+            uint32_t count = telemetry->statistic.crsfPackets[type];
+            if (count == 0) continue;
+            jsonAppend(&writer, "%s\"0x%02X\":%lu", first ? "" : ",", type, (unsigned long)count);
+            first = false;
+        }
+        jsonAppend(&writer, "}}");
+    }
+    jsonAppend(&writer, "}");
+
+    return writer.overflow ? -1 : writer.length;
+}
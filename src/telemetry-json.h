@@ -0,0 +1,17 @@
+#ifndef _TELEMETRY_JSON_H_
+#define _TELEMETRY_JSON_H_
+#include <Arduino.h>
+#include "crsf.h"
+
+// Enough for one vehicle with a few dozen frame types
+#define TELEMETRY_JSON_MAX_LEN  1024
+
+// Packet counters, on top of the TELEMETRY_* groups
+#define TELEMETRY_JSON_STATISTIC    (1 << 8)
+
+// Writes one vehicle as a JSON object into buffer, no heap is used.
+// Only the enabled groups selected in groups are written.
+// Returns the length, or -1 if the buffer is too small.
+int telemetryToJson(const TelemetryData_t* telemetry, uint8_t systemId, const uint8_t* mac,
+                    uint32_t groups, char* buffer, int size);
+#endif
@@ -0,0 +1,204 @@
+#include <esp_timer.h>
+#include "trace.h"
+
+// Log-linear buckets as in HdrHistogram: exact below 16 us, then 8 buckets
+// per power of two, so a bucket is at most 12.5% wide
+#define HISTOGRAM_LINEAR        16
+#define HISTOGRAM_SUB_BITS      3
+#define HISTOGRAM_BUCKETS       (HISTOGRAM_LINEAR + (32 - 4) * (1 << HISTOGRAM_SUB_BITS))
+
+struct LatencyHistogram_t {
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+    uint32_t buckets[HISTOGRAM_BUCKETS];
+};
+
+static const char* const spanNames[TRACE_SPANS] = {
+    "total", "enqueue", "queue", "parse", "encode", "send"
+};
+
+static const char* const spanDescriptions[TRACE_SPANS] = {
+    "total: receive to sent",
+    "enqueue: receive to in the packet buffer",
+    "queue: packet buffer to processing task",
+    "parse: MSP/CRSF decoding",
+    "encode: MAVLink encoding",
+    "send: datagram batching and UDP send",
+};
+
+static TraceRecord_t traceRing[TRACE_RING_SIZE];
+static uint32_t traceFrames = 0;
+static TraceRecord_t pending[TRACE_PENDING_MAX];     // copies, the ring slots get reused
+static int pendingCount = 0;
+static LatencyHistogram_t histograms[TRACE_SPANS];
+static volatile bool resetRequested = false;
+
+static int bucketOf(uint32_t value) {
+    if (value < HISTOGRAM_LINEAR) return value;
+    int msb = 31 - __builtin_clz(value);
+    int sub = (value >> (msb - HISTOGRAM_SUB_BITS)) & ((1 << HISTOGRAM_SUB_BITS) - 1);
+    return HISTOGRAM_LINEAR + ((msb - 4) << HISTOGRAM_SUB_BITS) + sub;
+}
+
+// Highest value that falls into the bucket
+static uint32_t bucketValue(int bucket) {
+    if (bucket < HISTOGRAM_LINEAR) return bucket;
+    int msb = ((bucket - HISTOGRAM_LINEAR) >> HISTOGRAM_SUB_BITS) + 4;
+    int sub = (bucket - HISTOGRAM_LINEAR) & ((1 << HISTOGRAM_SUB_BITS) - 1);
+    uint32_t width = 1u << (msb - HISTOGRAM_SUB_BITS);
+    return (((1u << HISTOGRAM_SUB_BITS) + sub) * width) + (width - 1);
+}
+
+static void histogramRecord(LatencyHistogram_t* histogram, uint64_t value) {
+    uint32_t clamped = value > 0xFFFFFFFFull ? 0xFFFFFFFF : (uint32_t)value;
+    histogram->buckets[bucketOf(clamped)]++;
+    histogram->sum += clamped;
+    if (clamped > histogram->max) histogram->max = clamped;
+    histogram->count++;
+}
+
+#ifdef LATENCY_TRACE
+TraceRecord_t* traceBegin(uint32_t received, uint32_t enqueued, uint16_t len) {
+    uint64_t now = esp_timer_get_time();
+    uint32_t now32 = (uint32_t)now;
+
+    TraceRecord_t* record = &traceRing[traceFrames & (TRACE_RING_SIZE - 1)];
+    memset(record, 0, sizeof(TraceRecord_t));
+    record->frame = traceFrames++;
+    record->len = len;
+    record->time[TRACE_RECEIVE] = now - (uint32_t)(now32 - received);
+    record->time[TRACE_ENQUEUE] = now - (uint32_t)(now32 - enqueued);
+    record->time[TRACE_DEQUEUE] = now;
+    return record;
+}
+
+void traceStamp(TraceRecord_t* record, TraceStage_e stage) {
+    record->time[stage] = esp_timer_get_time();
+}
+
+void traceEnd(TraceRecord_t* record) {
+    if (resetRequested) {
+        memset(histograms, 0, sizeof(histograms));
+        resetRequested = false;
+    }
+
+    // Every stage against the previous one, when both were reached.
+    // The spans are numbered as the stage they end with.
+    for (int stage = TRACE_ENQUEUE; stage < TRACE_STAGES; stage++) {
+        if (record->time[stage] != 0 && record->time[stage - 1] != 0) {
+            histogramRecord(&histograms[stage], record->time[stage] - record->time[stage - 1]);
+        }
+    }
+    if (record->time[TRACE_SENT] != 0) {
+        histogramRecord(&histograms[TRACE_SPAN_TOTAL], record->time[TRACE_SENT] - record->time[TRACE_RECEIVE]);
+    }
+}
+
+void traceHold(TraceRecord_t* record) {
+    if (pendingCount == TRACE_PENDING_MAX) {
+        // More frames than expected in one datagram: leave the send time out
+        traceEnd(record);
+        return;
+    }
+    // The datagram may be flushed after more than TRACE_RING_SIZE frames
+    pending[pendingCount++] = *record;
+}
+
+void traceSent() {
+    uint64_t now = esp_timer_get_time();
+    for (int i = 0; i < pendingCount; i++) {
+        pending[i].time[TRACE_SENT] = now;
+        traceEnd(&pending[i]);
+    }
+    pendingCount = 0;
+}
+#endif
+
+uint32_t traceCount(int span) {
+    return histograms[span].count;
+}
+
+uint32_t traceMax(int span) {
+    return histograms[span].max;
+}
+
+uint32_t tracePercentile(int span, float percentile) {
+    const LatencyHistogram_t* histogram = &histograms[span];
+    uint32_t count = histogram->count;
+    if (count == 0) return 0;
+
+    uint32_t target = (uint32_t)(count * percentile / 100.0f + 0.5f);
+    if (target == 0) target = 1;
+    uint32_t seen = 0;
+    for (int bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+        seen += histogram->buckets[bucket];
+        if (seen >= target) {
+            uint32_t value = bucketValue(bucket);
+            return value < histogram->max ? value : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+const char* traceSpanName(int span) {
+    return spanNames[span];
+}
+
+void traceReset() {
+    resetRequested = true;
+}
+
+void traceReportBegin(TraceReport_t* report) {
+    memset(report, 0, sizeof(TraceReport_t));
+}
+
+// Same layout as HdrHistogram's percentile distribution output
+int traceReportLine(TraceReport_t* report, char* buffer, int size) {
+    if (report->span >= TRACE_SPANS) return 0;
+
+    const LatencyHistogram_t* histogram = &histograms[report->span];
+    TraceReport_t next = *report;
+    char line[160];
+    int length;
+
+    if (next.line == 0) {
+        length = snprintf(line, sizeof(line), "# %s [us]\n%12s %14s %10s %14s\n\n",
+                          spanDescriptions[next.span], "Value", "Percentile", "TotalCount", "1/(1-Percentile)");
+        next.line = 1;
+        next.bucket = 0;
+        next.seen = 0;
+    } else {
+        while (next.bucket < HISTOGRAM_BUCKETS && histogram->buckets[next.bucket] == 0) {
+            next.bucket++;
+        }
+        if (next.bucket < HISTOGRAM_BUCKETS) {
+            uint32_t count = histogram->count;
+            next.seen += histogram->buckets[next.bucket];
+            double percentile = count > next.seen ? (double)next.seen / count : 1.0;
+            uint32_t value = bucketValue(next.bucket);
+            if (value > histogram->max) value = histogram->max;
+            if (percentile < 1.0) {
+                length = snprintf(line, sizeof(line), "%12lu %14.12f %10lu %14.2f\n", (unsigned long)value,
+                                  percentile, (unsigned long)next.seen, 1.0 / (1.0 - percentile));
+            } else {
+                length = snprintf(line, sizeof(line), "%12lu %14.12f %10lu\n", (unsigned long)value,
+                                  percentile, (unsigned long)next.seen);
+            }
+            next.bucket++;
+        } else {
+            uint32_t count = histogram->count;
+            length = snprintf(line, sizeof(line), "#[Mean    = %12.3f, Max            = %12lu]\n"
+                                                  "#[Total count    = %10lu]\n\n",
+                              count ? (double)histogram->sum / count : 0.0, (unsigned long)histogram->max,
+                              (unsigned long)count);
+            next.span++;
+            next.line = 0;
+        }
+    }
+
+    if (length >= size) return -1;
+    memcpy(buffer, line, length);
+    *report = next;
+    return length;
+}
@@ -0,0 +1,80 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+#include <Arduino.h>
+
+// Latency of every ESP-NOW frame through the bridge, stage by stage.
+// Comment out to compile the tracing out.
+#define LATENCY_TRACE
+
+#define TRACE_RING_SIZE         64      // frames, power of two
+#define TRACE_PENDING_MAX       32      // frames waiting in the outgoing datagram
+
+// Trace points of a frame
+typedef enum {
+    TRACE_RECEIVE = 0,      // ESP-NOW callback entered
+    TRACE_ENQUEUE,          // in the packet buffer
+    TRACE_DEQUEUE,          // picked up by the processing task
+    TRACE_PARSED,           // MSP/CRSF decoded into the vehicle state
+    TRACE_ENCODED,          // MAVLink messages written into the datagram
+    TRACE_SENT,             // datagram handed to the UDP stack (send returned)
+    TRACE_STAGES
+} TraceStage_e;
+
+// Latency histograms: receive to sent, then one per stage (from the previous one)
+typedef enum {
+    TRACE_SPAN_TOTAL = 0,
+    TRACE_SPAN_ENQUEUE,
+    TRACE_SPAN_QUEUE,
+    TRACE_SPAN_PARSE,
+    TRACE_SPAN_ENCODE,
+    TRACE_SPAN_SEND,
+    TRACE_SPANS
+} TraceSpan_e;
+
+// One frame in the trace ring, time 0 = stage not reached
+struct TraceRecord_t {
+    uint64_t time[TRACE_STAGES];    // us since boot
+    uint32_t frame;                 // frame number
+    uint16_t len;                   // ESP-NOW payload bytes
+};
+
+// HDR-style percentile report, produced a line at a time
+struct TraceReport_t {
+    int span;
+    int bucket;
+    uint32_t seen;      // count below the current bucket
+    int line;           // position inside the span
+};
+
+#ifdef LATENCY_TRACE
+// Processing task side. Receive and enqueue times are the 32-bit micros()
+// stamps stored with the frame, extended to 64 bits here.
+TraceRecord_t* traceBegin(uint32_t received, uint32_t enqueued, uint16_t len);
+void traceStamp(TraceRecord_t* record, TraceStage_e stage);
+// The frame is done: adds it to the histograms
+void traceEnd(TraceRecord_t* record);
+// The frame waits in the datagram, it is done at the next traceSent.
+// The record is copied, so the ring slot may be reused meanwhile.
+void traceHold(TraceRecord_t* record);
+void traceSent();
+#else
+static inline TraceRecord_t* traceBegin(uint32_t, uint32_t, uint16_t) { return NULL; }
+static inline void traceStamp(TraceRecord_t*, TraceStage_e) {}
+static inline void traceEnd(TraceRecord_t*) {}
+static inline void traceHold(TraceRecord_t*) {}
+static inline void traceSent() {}
+#endif
+
+// Readers, safe from other tasks: counts may be off by the frames in flight
+uint32_t traceCount(int span);
+uint32_t traceMax(int span);
+uint32_t tracePercentile(int span, float percentile);
+const char* traceSpanName(int span);
+// Clears the histograms from the processing task at its next frame
+void traceReset();
+
+void traceReportBegin(TraceReport_t* report);
+// Writes the next report line, returns its length, 0 at the end or -1 if it
+// does not fit (the report does not move then)
+int traceReportLine(TraceReport_t* report, char* buffer, int size);
+#endif
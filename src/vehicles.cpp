@@ -0,0 +1,73 @@
+#include "vehicles.h"
+
+// Open-addressing table with linear probing, no allocation after start
+static Vehicle_t vehicles[MAX_VEHICLES];
+static int vehiclesUsed = 0;
+
+static uint32_t macHash(const uint8_t* mac) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < 6; i++) {
+        hash = (hash ^ mac[i]) * 16777619u;
+    }
+    return hash;
+}
+
+Vehicle_t* vehicleLookup(const uint8_t* mac) {
+    uint32_t index = macHash(mac) & (MAX_VEHICLES - 1);
+
+    for (int probe = 0; probe < MAX_VEHICLES; probe++) {
+        Vehicle_t* vehicle = &vehicles[index];
+        if (!vehicle->used) {
+            // New sender, system IDs are given in arrival order
+            memset(vehicle, 0, sizeof(Vehicle_t));
+            memcpy(vehicle->mac, mac, 6);
+            vehicle->systemId = ++vehiclesUsed;
+            schedulerInit(&vehicle->schedule, millis());
+            // Publish the slot to the readers only when it is filled
+            __atomic_store_n(&vehicle->used, true, __ATOMIC_RELEASE);
+            return vehicle;
+        }
+        if (memcmp(vehicle->mac, mac, 6) == 0) {
+            return vehicle;
+        }
+        index = (index + 1) & (MAX_VEHICLES - 1);
+    }
+    return NULL;
+}
+
+// Walks the table slots, returns NULL for a free slot
+Vehicle_t* vehicleAt(int index) {
+    if (index < 0 || index >= MAX_VEHICLES) return NULL;
+    if (!__atomic_load_n(&vehicles[index].used, __ATOMIC_ACQUIRE)) return NULL;
+    return &vehicles[index];
+}
+
+int vehicleCount() {
+    return vehiclesUsed;
+}
+
+void vehicleWriteBegin(Vehicle_t* vehicle) {
+    __atomic_store_n(&vehicle->sequence, vehicle->sequence + 1, __ATOMIC_RELAXED);
+    // The odd sequence is visible before any telemetry store
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+void vehicleWriteEnd(Vehicle_t* vehicle) {
+    __atomic_store_n(&vehicle->sequence, vehicle->sequence + 1, __ATOMIC_RELEASE);
+}
+
+bool vehicleSnapshot(int index, TelemetryData_t* telemetry) {
+    Vehicle_t* vehicle = vehicleAt(index);
+    if (vehicle == NULL) return false;
+
+    for (;;) {
+        uint32_t sequence = __atomic_load_n(&vehicle->sequence, __ATOMIC_ACQUIRE);
+        if (sequence & 1) continue;     // being written
+
+        memcpy(telemetry, &vehicle->telemetry, sizeof(TelemetryData_t));
+
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&vehicle->sequence, __ATOMIC_RELAXED) == sequence) return true;
+    }
+}
@@ -0,0 +1,33 @@
+#ifndef _VEHICLES_H_
+#define _VEHICLES_H_
+#include <Arduino.h>
+#include "crsf.h"
+#include "scheduler.h"
+
+// Vehicle table capacity, must be a power of two
+#define MAX_VEHICLES 8
+
+// One TX backpack / vehicle, identified by the ESP-NOW sender MAC
+struct Vehicle_t {
+    bool used;
+    uint8_t mac[6];
+    uint8_t systemId;           // MAVLink system ID
+    TelemetryData_t telemetry;
+    volatile uint32_t sequence; // seqlock of telemetry, odd while it is written
+    MessageSchedule_t schedule; // MAVLink message rates
+};
+
+// Finds the vehicle of the sender, adds it if it is new.
+// Returns NULL if the table is full.
+Vehicle_t* vehicleLookup(const uint8_t* mac);
+Vehicle_t* vehicleAt(int index);
+int vehicleCount();
+
+// Telemetry is updated only by the processing task, between these calls.
+// The writer never waits for readers.
+void vehicleWriteBegin(Vehicle_t* vehicle);
+void vehicleWriteEnd(Vehicle_t* vehicle);
+// Coherent copy of the telemetry for a reader in another task,
+// retried if the writer was active meanwhile
+bool vehicleSnapshot(int index, TelemetryData_t* telemetry);
+#endif
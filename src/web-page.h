@@ -0,0 +1,273 @@
+// Generated by scripts/compress-page.py from web/setup.html, do not edit
+#ifndef _WEB_PAGE_H_
+#define _WEB_PAGE_H_
+#include <Arduino.h>
+
+// 4167 bytes, 16238 before compression
+#define HTML_PAGE_ETAG "\"3607db2b6727ac27\""
+
+const uint8_t htmlPageGz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x3b, 0xdb, 0x6e, 0xe3, 0x48,
+    0x76, 0xef, 0xfe, 0x8a, 0x6a, 0xcd, 0xf4, 0x8a, 0xca, 0x98, 0x92, 0x2c, 0x5b, 0xee, 0x1e, 0xfa,
+    0x02, 0xb8, 0x65, 0x7b, 0xd7, 0xc9, 0xf4, 0xb4, 0xb1, 0xf6, 0xec, 0xcc, 0xa2, 0xd3, 0x3b, 0x5d,
+    0x22, 0x4b, 0x12, 0xa7, 0x29, 0x92, 0x21, 0x4b, 0x96, 0xbd, 0x5e, 0x03, 0x9b, 0x4d, 0x80, 0x3c,
+    0x24, 0x0f, 0x41, 0xb2, 0xef, 0x41, 0x9e, 0xf2, 0x1a, 0x04, 0x99, 0x64, 0x11, 0x24, 0xfb, 0x0d,
+    0xee, 0x3f, 0xc9, 0x27, 0xe4, 0xd4, 0x85, 0xc5, 0xaa, 0x22, 0x29, 0xcb, 0x3d, 0xbd, 0x08, 0x02,
+    0xa4, 0x7b, 0x7a, 0x2c, 0x55, 0x9d, 0x3a, 0xf7, 0x5b, 0x5d, 0xbc, 0xff, 0xe4, 0xf8, 0xd5, 0xe8,
+    0xf2, 0xe7, 0xe7, 0x27, 0xe8, 0x27, 0x97, 0x2f, 0xbf, 0x38, 0xdc, 0xd8, 0x9f, 0xd1, 0x79, 0xc4,
+    0x7e, 0x10, 0x1c, 0x1c, 0x6e, 0x20, 0xb4, 0x4f, 0x43, 0x1a, 0x91, 0xc3, 0x93, 0x8b, 0xf3, 0xed,
+    0x01, 0xca, 0x09, 0x5d, 0xa4, 0xfb, 0x3d, 0x31, 0xc4, 0x26, 0xe7, 0x84, 0x62, 0xe4, 0xcf, 0x70,
+    0x06, 0x33, 0x07, 0xad, 0xaf, 0x2e, 0x4f, 0xdd, 0xe7, 0x2d, 0x3e, 0x91, 0xd3, 0x1b, 0x01, 0x82,
+    0xd0, 0x38, 0x09, 0x6e, 0xd0, 0x2d, 0xff, 0x88, 0xd0, 0x24, 0x89, 0xa9, 0x3b, 0xc1, 0xf3, 0x30,
+    0xba, 0xf1, 0xd0, 0x51, 0x16, 0xe2, 0x68, 0x13, 0xe5, 0x38, 0xce, 0xdd, 0x9c, 0x64, 0xe1, 0x64,
+    0x4f, 0x42, 0xcd, 0xf1, 0xb5, 0xbb, 0x0c, 0x03, 0x3a, 0xf3, 0xd0, 0xb0, 0xdf, 0x4f, 0xaf, 0xcb,
+    0xf1, 0x6c, 0x1a, 0xc6, 0x6c, 0x30, 0xbd, 0x46, 0x78, 0x41, 0x93, 0x62, 0x22, 0xc5, 0x41, 0x10,
+    0xc6, 0x53, 0x0f, 0x0d, 0x34, 0xe8, 0x31, 0xf6, 0xdf, 0x4d, 0xb3, 0x64, 0x11, 0x07, 0xae, 0x9f,
+    0x44, 0x49, 0xe6, 0xa1, 0x4f, 0x26, 0x43, 0xf6, 0xb7, 0x00, 0x98, 0x91, 0x70, 0x3a, 0xa3, 0x9e,
+    0x86, 0xe9, 0x8e, 0xff, 0xbf, 0xeb, 0x03, 0x97, 0x38, 0x8c, 0x49, 0xa6, 0xf8, 0x2e, 0x71, 0x79,
+    0x68, 0x39, 0x0b, 0x29, 0x59, 0x4d, 0x39, 0xc9, 0x02, 0x92, 0xb9, 0x19, 0x0e, 0xc2, 0x45, 0xee,
+    0xa1, 0x2d, 0x63, 0xea, 0xda, 0xcd, 0x67, 0x38, 0x48, 0x96, 0x1e, 0xea, 0xa3, 0x01, 0xc8, 0xc1,
+    0x66, 0x51, 0x36, 0x1d, 0x63, 0xa7, 0xbf, 0xc9, 0xff, 0x76, 0xb7, 0x3a, 0xcd, 0x1c, 0x82, 0x12,
+    0xc2, 0xd8, 0x6d, 0xe2, 0x7c, 0x36, 0x50, 0x1c, 0x17, 0x22, 0x6f, 0x6f, 0x6f, 0x17, 0x2b, 0x29,
+    0xb9, 0xa6, 0x2e, 0x8e, 0xc2, 0x29, 0xa8, 0xd0, 0x27, 0x31, 0x25, 0x99, 0xa9, 0x58, 0x77, 0x9c,
+    0x50, 0x9a, 0xcc, 0x3d, 0xb4, 0xad, 0x18, 0x96, 0x0a, 0x09, 0xe3, 0x74, 0x41, 0x5d, 0xa6, 0x80,
+    0x54, 0x11, 0xb0, 0xd6, 0x0c, 0xac, 0x35, 0x11, 0x1e, 0x93, 0x48, 0x01, 0x07, 0x61, 0x9e, 0x46,
+    0x18, 0x6c, 0x3e, 0x8e, 0x12, 0xff, 0x5d, 0x03, 0xd9, 0xe7, 0xa5, 0x9a, 0xb8, 0x9f, 0x2c, 0xa5,
+    0x94, 0xe3, 0x24, 0x0a, 0xf6, 0x2c, 0xb1, 0x86, 0xc3, 0xa1, 0x4e, 0x8d, 0x33, 0xa8, 0xa8, 0x49,
+    0xdf, 0x19, 0xe8, 0xbe, 0xa3, 0x0c, 0xb5, 0x63, 0xdb, 0xc9, 0xe3, 0x66, 0xc8, 0x93, 0x28, 0x0c,
+    0xd0, 0x27, 0x41, 0x10, 0x34, 0x58, 0x71, 0xc7, 0xe2, 0x2e, 0x0f, 0x7f, 0x49, 0xc0, 0xb6, 0x03,
+    0x6b, 0xb8, 0x70, 0xee, 0x79, 0x12, 0x27, 0x79, 0x8a, 0x7d, 0xe5, 0x29, 0x11, 0xa1, 0xa0, 0x71,
+    0x97, 0x8d, 0x71, 0x3e, 0xb6, 0x4c, 0x7d, 0x71, 0x09, 0xbc, 0x49, 0xe2, 0x2f, 0xf2, 0xd2, 0xeb,
+    0x04, 0x07, 0x85, 0xcc, 0x3b, 0xa3, 0xa3, 0xd3, 0x61, 0xbf, 0xc0, 0x97, 0x2c, 0x68, 0x04, 0x3e,
+    0xea, 0xa1, 0x38, 0x89, 0x89, 0x61, 0xad, 0x39, 0xf6, 0x5d, 0x72, 0x8d, 0xe7, 0x69, 0x44, 0xcc,
+    0xc0, 0x93, 0x2c, 0x6b, 0x92, 0x14, 0xa8, 0x77, 0x77, 0x77, 0x2d, 0xa3, 0xd0, 0x24, 0x85, 0x40,
+    0x5b, 0x4f, 0x38, 0x49, 0x77, 0xbc, 0x00, 0x3b, 0xc6, 0x96, 0x9b, 0x28, 0xcb, 0x4f, 0x22, 0xa2,
+    0x90, 0x4d, 0x71, 0x6a, 0x86, 0x85, 0x4e, 0xd4, 0xf6, 0x3e, 0x81, 0xb6, 0x94, 0x04, 0xf0, 0xc0,
+    0xe2, 0x8a, 0x5d, 0xb7, 0x6a, 0x0c, 0x5b, 0xaa, 0xa6, 0x62, 0xce, 0xdd, 0x7a, 0x73, 0xee, 0xae,
+    0xe3, 0x83, 0x8b, 0x2c, 0x67, 0x5a, 0x4b, 0x93, 0x50, 0x0f, 0x22, 0x9a, 0x41, 0x22, 0x0b, 0x69,
+    0x98, 0x40, 0x78, 0x95, 0xf9, 0x02, 0xf5, 0xbb, 0xdb, 0xb9, 0xa9, 0x26, 0x1a, 0xbb, 0x39, 0xbe,
+    0x22, 0xb5, 0xc9, 0xc5, 0x32, 0xb2, 0xb4, 0x8f, 0x96, 0x72, 0x2c, 0x24, 0xde, 0x2c, 0xb9, 0x6a,
+    0xc8, 0x53, 0x9f, 0xec, 0x0c, 0x71, 0x7f, 0xe7, 0xf3, 0xca, 0x32, 0x60, 0x3f, 0x83, 0xe8, 0xaf,
+    0x5f, 0x33, 0xd8, 0xfa, 0x7c, 0xf7, 0x74, 0x7b, 0x2d, 0xf2, 0x12, 0xcf, 0x2a, 0x0e, 0xfa, 0xe3,
+    0x67, 0x41, 0x80, 0x8d, 0x95, 0x39, 0xc5, 0x54, 0x73, 0x71, 0xdd, 0xf0, 0x83, 0xba, 0x70, 0xdd,
+    0x1a, 0x36, 0xe6, 0x55, 0xcd, 0x56, 0xcd, 0xa9, 0x4d, 0xf9, 0x5f, 0x25, 0x4c, 0xf2, 0x85, 0xef,
+    0x93, 0x3c, 0xaf, 0xe7, 0x3c, 0xd8, 0x21, 0x8a, 0xf3, 0x32, 0x4c, 0xb6, 0x86, 0xc3, 0x67, 0x83,
+    0x1d, 0xdb, 0xcb, 0xb6, 0xca, 0xf4, 0xe1, 0x6f, 0x93, 0x5d, 0x7f, 0x6c, 0x90, 0x21, 0x59, 0x96,
+    0x34, 0xa8, 0x67, 0xf2, 0x3c, 0x78, 0x56, 0x25, 0xf2, 0x6c, 0xb0, 0xe5, 0xaf, 0x24, 0x32, 0x19,
+    0xfa, 0x36, 0x91, 0x30, 0x9e, 0x24, 0x90, 0x47, 0xaf, 0xeb, 0xe9, 0x90, 0xed, 0xc9, 0x60, 0x62,
+    0xe7, 0xb5, 0x88, 0x4c, 0x28, 0xcf, 0x6a, 0x05, 0x5a, 0xd3, 0xf4, 0xb5, 0x06, 0xb0, 0x73, 0x7e,
+    0xb3, 0x6d, 0x76, 0xac, 0x0a, 0x22, 0x9d, 0xc5, 0x85, 0xdc, 0x54, 0xdf, 0x0c, 0x54, 0xf2, 0xa5,
+    0xa5, 0xa9, 0xc9, 0xe7, 0x13, 0x5c, 0xe5, 0xad, 0xff, 0x30, 0x03, 0x65, 0xdb, 0xc0, 0x2b, 0x6d,
+    0xff, 0xc1, 0xf0, 0x6e, 0xf6, 0x25, 0x3d, 0x51, 0x3c, 0xaf, 0x26, 0x51, 0x55, 0x6a, 0x8d, 0xaa,
+    0x99, 0x25, 0xcb, 0xd5, 0xc9, 0x90, 0x93, 0x72, 0x21, 0xc2, 0xe6, 0xb9, 0x4d, 0xb0, 0x29, 0x4f,
+    0x16, 0x06, 0x18, 0xae, 0xaa, 0xb9, 0xac, 0x51, 0x90, 0x95, 0xf0, 0xb9, 0x96, 0x52, 0x05, 0x6f,
+    0xcb, 0x70, 0x12, 0xba, 0x9c, 0x41, 0x68, 0xc0, 0x48, 0x44, 0x7c, 0xaa, 0x0d, 0xfd, 0x1f, 0x2d,
+    0xa4, 0xb2, 0xbb, 0x0a, 0x7f, 0xc9, 0x87, 0x25, 0x55, 0x16, 0x14, 0x4f, 0xc2, 0x79, 0x9a, 0x64,
+    0x14, 0xc7, 0xd4, 0x54, 0x02, 0xc5, 0xe3, 0xdc, 0xad, 0x36, 0x7b, 0x52, 0xea, 0xad, 0x7e, 0xff,
+    0xe9, 0xde, 0x43, 0xfd, 0x1f, 0xcb, 0x7d, 0x93, 0x88, 0x75, 0x73, 0xb3, 0x30, 0x08, 0x48, 0x5c,
+    0x43, 0x80, 0xb5, 0xd2, 0x1a, 0xf6, 0x5a, 0x1f, 0xd0, 0xf1, 0xb3, 0xaa, 0x8e, 0x33, 0x28, 0xa3,
+    0xa0, 0x2f, 0xf0, 0x06, 0x67, 0x6b, 0x7b, 0x18, 0x90, 0xe9, 0x26, 0x2b, 0xd2, 0xcf, 0x08, 0xc1,
+    0xa8, 0xff, 0x14, 0x3e, 0x3f, 0xdb, 0xdd, 0x19, 0xe3, 0x01, 0xe7, 0xb1, 0x63, 0xe9, 0xb9, 0x70,
+    0x8e, 0xad, 0x1a, 0x63, 0x68, 0x8c, 0x71, 0xc1, 0xf5, 0x3a, 0x50, 0x93, 0x29, 0xc1, 0x39, 0xe3,
+    0x70, 0x8e, 0x45, 0x4d, 0x9b, 0x80, 0x18, 0x67, 0x31, 0xd4, 0xb3, 0x61, 0x8e, 0x08, 0xce, 0x09,
+    0xf8, 0x8a, 0x0b, 0x4d, 0xc8, 0xaa, 0x6e, 0xba, 0x42, 0xac, 0x8b, 0x7d, 0x1a, 0x6a, 0xa5, 0xaf,
+    0xae, 0x2f, 0xd4, 0x97, 0x41, 0x9d, 0x79, 0xb8, 0xf0, 0x0f, 0x65, 0x17, 0x5d, 0xa7, 0xcc, 0x6a,
+    0x07, 0x60, 0x8e, 0x55, 0x2b, 0x5c, 0x63, 0xaf, 0x64, 0x24, 0x8c, 0xdd, 0x7e, 0xff, 0x11, 0xed,
+    0x00, 0x8e, 0x22, 0xde, 0x07, 0x70, 0xbd, 0x29, 0x01, 0x92, 0x62, 0x3a, 0x23, 0x11, 0x66, 0x6a,
+    0xa9, 0x95, 0xdf, 0xf3, 0xf0, 0x84, 0x6a, 0xfe, 0x23, 0x35, 0xe9, 0xa1, 0x76, 0xbb, 0x8a, 0x09,
+    0xfc, 0x2d, 0x89, 0x16, 0x54, 0x13, 0x59, 0xf8, 0x42, 0xbf, 0x0c, 0x1e, 0x96, 0xf5, 0x87, 0xa5,
+    0x67, 0x4b, 0x67, 0xef, 0xdb, 0x66, 0xdc, 0xae, 0xd7, 0xe7, 0x27, 0x93, 0x09, 0x19, 0x6f, 0x8f,
+    0xd7, 0x16, 0x92, 0x03, 0x4c, 0x92, 0x0c, 0x78, 0xe0, 0x1f, 0x41, 0x50, 0xf2, 0x8d, 0xe3, 0x0e,
+    0x95, 0xdb, 0xda, 0xd2, 0x36, 0x77, 0x13, 0x7c, 0x8f, 0x34, 0x18, 0x0e, 0x37, 0x8b, 0x7f, 0xe5,
+    0x4e, 0xc9, 0x42, 0x62, 0x7b, 0xd9, 0x43, 0x58, 0x86, 0x2b, 0xd1, 0xd8, 0x06, 0x50, 0x39, 0xf5,
+    0xa9, 0xb9, 0xea, 0x8a, 0xcc, 0x42, 0xdf, 0x6e, 0xb9, 0x1b, 0xb3, 0x98, 0xee, 0x64, 0x8d, 0xba,
+    0xfe, 0xf8, 0x55, 0x8f, 0x3b, 0x3a, 0xcf, 0x9d, 0x40, 0x38, 0xcd, 0x74, 0x97, 0xdb, 0xef, 0xc9,
+    0x5d, 0xfb, 0x7e, 0x4f, 0xec, 0xfe, 0x37, 0xf6, 0xd9, 0xde, 0x9d, 0xef, 0xe7, 0x83, 0xf0, 0x0a,
+    0xf9, 0x11, 0xce, 0xf3, 0x83, 0x96, 0xca, 0x97, 0x2d, 0xb1, 0xbf, 0xd7, 0xe7, 0xcc, 0x84, 0x2a,
+    0x01, 0x6a, 0x40, 0x44, 0x4a, 0x54, 0xf3, 0x00, 0x21, 0x9b, 0xfc, 0x12, 0x88, 0x87, 0xbe, 0x30,
+    0x40, 0x0b, 0x05, 0x98, 0x62, 0x17, 0x06, 0x0f, 0x5a, 0x6c, 0x6f, 0x03, 0x1f, 0x5a, 0x28, 0x0c,
+    0xd4, 0x17, 0x06, 0xda, 0x3a, 0xfc, 0xef, 0x7f, 0xf8, 0xed, 0x3f, 0xa1, 0x97, 0x47, 0x23, 0xf7,
+    0x28, 0x08, 0x32, 0xe8, 0xeb, 0xf6, 0x7b, 0x02, 0xe7, 0x43, 0x44, 0x74, 0xec, 0xbc, 0x04, 0x2a,
+    0xf4, 0xc5, 0xb7, 0x02, 0xff, 0xdf, 0xff, 0x1b, 0xfa, 0xfa, 0xec, 0xf4, 0xec, 0x43, 0x10, 0x53,
+    0x28, 0xb1, 0x73, 0x42, 0xb3, 0x9b, 0x12, 0xbb, 0x31, 0xa4, 0x48, 0xfc, 0x23, 0xba, 0x2c, 0xc6,
+    0x6d, 0x3a, 0xfb, 0x3d, 0x50, 0xe3, 0xe1, 0x86, 0xae, 0x53, 0x4d, 0x09, 0x2d, 0x9d, 0x7a, 0x91,
+    0xda, 0xa5, 0xfe, 0x34, 0x4e, 0x35, 0x4b, 0x14, 0x3d, 0xa3, 0x36, 0xcd, 0x4f, 0x6e, 0xb2, 0x24,
+    0x9e, 0x1e, 0x8e, 0xe4, 0x26, 0x41, 0x1c, 0xfc, 0x68, 0x6a, 0xf5, 0x98, 0x9b, 0x70, 0x10, 0x7d,
+    0x55, 0xc1, 0x8c, 0x6c, 0xf3, 0x5e, 0x62, 0x5f, 0xf1, 0xa3, 0x75, 0x7e, 0xad, 0xc3, 0x2f, 0x12,
+    0x1c, 0x74, 0xbb, 0x5d, 0x29, 0x8a, 0x5a, 0x6e, 0x48, 0x66, 0x73, 0xa9, 0x8e, 0x1e, 0x4c, 0x46,
+    0x45, 0xb3, 0x03, 0xa9, 0x85, 0xab, 0xa0, 0x75, 0xf8, 0x25, 0x59, 0xd6, 0x72, 0xcb, 0xe1, 0x8c,
+    0x95, 0xa2, 0xc7, 0xa1, 0x37, 0x29, 0x61, 0x56, 0xb8, 0xa6, 0xca, 0x99, 0x5a, 0x28, 0xc6, 0x73,
+    0x22, 0x3e, 0x6a, 0x0b, 0xe4, 0x1f, 0x28, 0x54, 0x3e, 0x99, 0x41, 0xa3, 0x48, 0x80, 0xe4, 0xd1,
+    0x91, 0xf7, 0xe2, 0x85, 0x37, 0x1a, 0x79, 0xc7, 0xc7, 0xde, 0xc9, 0x89, 0x77, 0x7a, 0x5a, 0xb7,
+    0x00, 0xb3, 0x46, 0x25, 0x3e, 0x68, 0xfd, 0xc2, 0x79, 0xdd, 0x77, 0x3f, 0x3f, 0x72, 0x4f, 0xb1,
+    0x3b, 0x79, 0x73, 0x3b, 0xb8, 0x7b, 0xed, 0xb9, 0x6f, 0x3a, 0xb7, 0xc3, 0x3b, 0x6b, 0xb8, 0xf3,
+    0x69, 0x0d, 0x12, 0x7e, 0xd8, 0x76, 0xd0, 0x3a, 0x61, 0xa5, 0x05, 0xd1, 0x19, 0x61, 0xd2, 0xa1,
+    0x30, 0xe6, 0x1f, 0x59, 0x5e, 0xc5, 0x14, 0x7d, 0xf3, 0x8d, 0x67, 0xfe, 0xd7, 0xaa, 0xd8, 0x46,
+    0x2a, 0x53, 0x3b, 0x19, 0x68, 0x1d, 0x9e, 0xf2, 0xd5, 0x1e, 0xaa, 0x88, 0x82, 0x60, 0xbf, 0x72,
+    0x74, 0xe4, 0xbe, 0x78, 0xe1, 0x8e, 0x46, 0xee, 0xf1, 0xb1, 0x7b, 0x72, 0xe2, 0x9e, 0x9e, 0x3e,
+    0xc2, 0x64, 0xfa, 0x39, 0x80, 0xc9, 0x8a, 0x19, 0x27, 0xc5, 0x1e, 0xb6, 0x85, 0x92, 0xd8, 0x8f,
+    0x42, 0xff, 0xdd, 0x41, 0x8b, 0x7d, 0x05, 0xe7, 0x71, 0x3a, 0x2c, 0x18, 0xfe, 0xee, 0xf7, 0xe8,
+    0x82, 0xed, 0x93, 0x41, 0xe2, 0x6a, 0xcc, 0xd5, 0x62, 0x93, 0xbe, 0xa6, 0x21, 0x9c, 0x12, 0x3a,
+    0x52, 0x3e, 0x29, 0xd0, 0xfe, 0xf6, 0x2f, 0x51, 0xe1, 0xdd, 0xb5, 0x98, 0x0d, 0x49, 0x1b, 0x82,
+    0xae, 0x4c, 0x14, 0xd5, 0xa8, 0x6b, 0x0c, 0xb7, 0x06, 0x47, 0xae, 0xc0, 0xc0, 0x8e, 0xc1, 0x80,
+    0x30, 0x9d, 0x9d, 0x91, 0xfe, 0x76, 0x9e, 0x04, 0x60, 0xc1, 0xaf, 0xc3, 0xd3, 0x10, 0xbd, 0x84,
+    0x8f, 0x35, 0x5e, 0xce, 0x42, 0x99, 0xf7, 0xf5, 0x05, 0xee, 0xb2, 0xbd, 0x2f, 0xb3, 0x9b, 0xc0,
+    0xc3, 0xb4, 0x35, 0xc3, 0xf1, 0x94, 0x88, 0x41, 0x86, 0x70, 0xc4, 0xbf, 0x3b, 0x74, 0x16, 0xe6,
+    0xdd, 0x2b, 0x1c, 0x2d, 0x48, 0xc7, 0xe2, 0x08, 0xd0, 0x27, 0x29, 0xab, 0xfb, 0x88, 0x4f, 0x1f,
+    0xb4, 0x70, 0x2a, 0xf9, 0x39, 0x12, 0xbb, 0xea, 0x73, 0xd6, 0x0d, 0xed, 0xf7, 0x04, 0xd0, 0x03,
+    0x6b, 0x73, 0x8a, 0xe5, 0xe2, 0x51, 0xc4, 0x5a, 0x5e, 0xe4, 0x8c, 0x92, 0x38, 0x66, 0xbc, 0xd3,
+    0x04, 0xc5, 0x84, 0x2e, 0x93, 0xec, 0x5d, 0xa7, 0x1e, 0x17, 0x64, 0x23, 0x2e, 0xa5, 0xa1, 0x51,
+    0xd3, 0x55, 0x3f, 0x50, 0xc5, 0x79, 0x1e, 0x06, 0xad, 0xc3, 0x8b, 0x8b, 0xb3, 0xe3, 0x7a, 0xed,
+    0x8a, 0x2c, 0x52, 0xa3, 0x5c, 0x3b, 0xb1, 0x94, 0xd8, 0xaa, 0xd1, 0xad, 0xe2, 0x9b, 0x15, 0x16,
+    0xc4, 0x88, 0xb5, 0x3e, 0xbe, 0x24, 0x29, 0x80, 0x83, 0x0a, 0x41, 0x9a, 0x73, 0xf9, 0xe9, 0x63,
+    0x48, 0xa4, 0xb0, 0x3e, 0x24, 0x55, 0x49, 0xfe, 0xa3, 0x4b, 0xc6, 0xdc, 0x36, 0x26, 0x51, 0xeb,
+    0x70, 0x24, 0x3e, 0x7c, 0x0c, 0xb9, 0x0a, 0x9c, 0x0f, 0x89, 0xa5, 0x68, 0xaf, 0x2b, 0x55, 0x63,
+    0x5a, 0x5c, 0x37, 0x31, 0x7e, 0x0d, 0xec, 0x99, 0x99, 0xb1, 0xbe, 0x1d, 0xf9, 0x80, 0xe4, 0x58,
+    0xa2, 0xd6, 0xb2, 0x63, 0x13, 0xf6, 0xfa, 0x52, 0xb0, 0x32, 0x5f, 0x5a, 0xfd, 0xcf, 0xc3, 0x49,
+    0x93, 0x2d, 0x92, 0x0d, 0x75, 0x0e, 0xb5, 0x3d, 0x41, 0x0a, 0x03, 0xba, 0x21, 0xb4, 0x8e, 0xa4,
+    0xb5, 0x58, 0x9c, 0x33, 0x2a, 0x52, 0xf2, 0xeb, 0xa1, 0x06, 0xac, 0x3e, 0x96, 0x3c, 0xef, 0xe7,
+    0x7e, 0x16, 0xa6, 0x54, 0xf2, 0xdf, 0xeb, 0xa1, 0xe3, 0x30, 0xc7, 0x63, 0xe8, 0xe9, 0x59, 0xf8,
+    0x6e, 0x2a, 0x4f, 0x46, 0x22, 0x5d, 0xb2, 0x32, 0x7c, 0x74, 0x8e, 0x58, 0x0e, 0xdd, 0x90, 0x07,
+    0x13, 0x08, 0x7c, 0x09, 0x4a, 0x3e, 0x8e, 0x58, 0x28, 0xa3, 0x03, 0xd4, 0x6a, 0xed, 0x55, 0xa6,
+    0x8a, 0x20, 0xb4, 0xa6, 0x71, 0x2a, 0x9d, 0x98, 0x8d, 0x6f, 0xc9, 0x89, 0xc9, 0x22, 0xf6, 0x79,
+    0xa6, 0xb4, 0x12, 0xb3, 0x4a, 0xde, 0x1d, 0x7d, 0x5f, 0x98, 0x53, 0xce, 0xe8, 0xb7, 0x4c, 0x55,
+    0x80, 0x25, 0x48, 0xfc, 0xc5, 0x9c, 0x6d, 0xba, 0xc1, 0xce, 0x27, 0x4c, 0x7b, 0x31, 0x7d, 0x71,
+    0x73, 0x16, 0x38, 0x6d, 0x95, 0x91, 0xda, 0x9d, 0x3d, 0x63, 0x75, 0x21, 0xe0, 0x7a, 0x18, 0x0a,
+    0x68, 0x1b, 0x8b, 0x8c, 0x8c, 0xf5, 0x90, 0x48, 0x60, 0x86, 0x43, 0x22, 0x09, 0x27, 0xa8, 0x94,
+    0x0f, 0x1d, 0x1c, 0x80, 0x3a, 0xa0, 0xb8, 0x94, 0x82, 0x22, 0x5b, 0xc9, 0x4a, 0x66, 0x51, 0xaa,
+    0xf6, 0x14, 0x9c, 0x35, 0xc1, 0x14, 0x3b, 0xc7, 0x57, 0x51, 0x18, 0xbf, 0x6b, 0xd5, 0x01, 0x65,
+    0xb0, 0x2b, 0x79, 0x15, 0x47, 0x37, 0x00, 0x47, 0xb3, 0x7a, 0x3c, 0x7c, 0x87, 0xd4, 0x15, 0x3b,
+    0x7e, 0x00, 0x6b, 0xc7, 0x09, 0x3b, 0x2a, 0x8c, 0x92, 0x25, 0x09, 0xda, 0x7b, 0x1b, 0x15, 0x06,
+    0x35, 0x53, 0x1b, 0xaa, 0xb5, 0x19, 0xad, 0x99, 0xe4, 0x5e, 0x30, 0xd8, 0xde, 0x19, 0xee, 0x3e,
+    0x7b, 0xde, 0x6a, 0x82, 0x6c, 0xe4, 0xd8, 0x04, 0x5b, 0x93, 0x6b, 0xdd, 0x6e, 0x8a, 0x09, 0xe5,
+    0x96, 0x7b, 0xf5, 0x70, 0x1a, 0x0b, 0x13, 0x1c, 0xe5, 0xa4, 0x01, 0xcc, 0x66, 0x81, 0x25, 0xdd,
+    0x92, 0xf6, 0x1d, 0x22, 0xb0, 0x54, 0xb3, 0x70, 0xd5, 0x72, 0xba, 0xcd, 0x1f, 0x30, 0x9e, 0xc5,
+    0x47, 0xb3, 0xf5, 0x4c, 0x26, 0x9a, 0xcc, 0x60, 0x1b, 0x73, 0x0d, 0x63, 0x58, 0x1c, 0xac, 0xb6,
+    0x86, 0xcd, 0x85, 0x9e, 0x08, 0xaa, 0x26, 0xd9, 0x5b, 0x6d, 0x2e, 0x95, 0x39, 0x56, 0x19, 0xca,
+    0xf4, 0x95, 0x95, 0x76, 0x32, 0x5d, 0x45, 0x5a, 0x4b, 0x3f, 0xf6, 0x80, 0x24, 0xf9, 0x63, 0xc8,
+    0x5e, 0x7e, 0xd9, 0x51, 0xa3, 0xf1, 0x0d, 0x48, 0x0c, 0xe9, 0x31, 0x82, 0xcd, 0x5e, 0x18, 0x4f,
+    0x37, 0xc4, 0xa1, 0x49, 0x1c, 0x24, 0xcb, 0x6e, 0x12, 0xb3, 0x41, 0xa6, 0x21, 0x99, 0xd8, 0x9c,
+    0x32, 0xae, 0xd3, 0x8c, 0xa4, 0x38, 0x23, 0x97, 0x78, 0x9c, 0x3b, 0x2a, 0xa3, 0x58, 0xfd, 0x7b,
+    0x75, 0x58, 0x54, 0x2e, 0x79, 0x8c, 0xb1, 0x67, 0xf0, 0xc4, 0x78, 0x99, 0x64, 0xc9, 0x1c, 0xe5,
+    0x24, 0xbb, 0x22, 0x99, 0x99, 0x50, 0x2d, 0xc4, 0xe5, 0xa9, 0x0d, 0xa1, 0xfe, 0xcc, 0x69, 0xf7,
+    0xa4, 0x40, 0xdf, 0xc2, 0x96, 0xa9, 0xdd, 0x51, 0xba, 0xea, 0xc2, 0xb6, 0x2b, 0x76, 0x60, 0x67,
+    0x99, 0x42, 0xa6, 0x03, 0x7d, 0x1f, 0xa2, 0xe2, 0x73, 0x97, 0x99, 0xd1, 0xe9, 0xd8, 0xa0, 0xec,
+    0x08, 0x80, 0x81, 0xdd, 0x6a, 0xf5, 0xb3, 0x31, 0x21, 0x96, 0xbb, 0xe7, 0x76, 0x87, 0xe3, 0x1b,
+    0xc9, 0x7d, 0xfc, 0x01, 0x3f, 0x4a, 0xd8, 0x5b, 0x07, 0x07, 0xe7, 0x57, 0xb9, 0x83, 0xb9, 0xec,
+    0x4e, 0xe3, 0xce, 0xc7, 0x4c, 0x4e, 0x71, 0x39, 0x65, 0xf1, 0x97, 0xcf, 0x92, 0xe5, 0x05, 0xaf,
+    0x97, 0x4e, 0xfb, 0x84, 0x03, 0x64, 0x50, 0x78, 0x43, 0x72, 0x05, 0xc6, 0xe4, 0x4a, 0xc5, 0x62,
+    0x73, 0xdd, 0xde, 0x44, 0x6d, 0x8e, 0xa0, 0x2c, 0x00, 0x8c, 0xc6, 0x5e, 0x8d, 0x7b, 0xf0, 0x8e,
+    0x69, 0x0d, 0x5b, 0x08, 0x6b, 0x36, 0x1a, 0x83, 0x95, 0x85, 0x95, 0xd6, 0xd0, 0xc5, 0x60, 0x75,
+    0xe4, 0x89, 0x32, 0x4f, 0xf2, 0xae, 0x63, 0xcc, 0x42, 0x33, 0x37, 0x63, 0x57, 0x33, 0x31, 0x3b,
+    0x36, 0x60, 0x42, 0x38, 0x6f, 0x7f, 0x72, 0x79, 0x79, 0x8e, 0xb8, 0x40, 0x4f, 0x90, 0xe8, 0x17,
+    0x3c, 0xf4, 0xe9, 0xad, 0xc2, 0x20, 0x86, 0xee, 0xde, 0x76, 0x74, 0x3b, 0xdc, 0x69, 0x9f, 0x41,
+    0x4b, 0x8b, 0x2c, 0x2e, 0x3d, 0xe2, 0xbb, 0x9c, 0xf9, 0x77, 0xbd, 0xfa, 0x1b, 0x9d, 0xe3, 0x87,
+    0x95, 0xf1, 0x8f, 0x57, 0xca, 0x7f, 0x78, 0x39, 0xb7, 0xf1, 0xa8, 0x9a, 0xbe, 0x1e, 0x26, 0x06,
+    0xa9, 0x75, 0x05, 0x22, 0x89, 0xe8, 0x18, 0x0c, 0x27, 0xef, 0xaa, 0x39, 0x63, 0x05, 0xf3, 0x01,
+    0x73, 0x5a, 0x34, 0x14, 0x6c, 0xc7, 0x69, 0xfb, 0x83, 0xd5, 0x55, 0x94, 0xcb, 0x98, 0x8a, 0xf7,
+    0x6a, 0x41, 0xb5, 0xfa, 0x5e, 0x82, 0xa7, 0xaa, 0x4e, 0x18, 0x6b, 0xaa, 0x25, 0x6d, 0x15, 0x85,
+    0x75, 0x0a, 0xdb, 0xe3, 0x8a, 0x5b, 0x73, 0x81, 0xab, 0x63, 0xbd, 0x79, 0xd5, 0x6a, 0x7e, 0x1e,
+    0x57, 0xea, 0xd6, 0x2b, 0x63, 0xeb, 0x97, 0xb2, 0x0f, 0x2a, 0x67, 0xb5, 0x0d, 0x48, 0xb5, 0x14,
+    0x97, 0x5a, 0xf2, 0x8b, 0x86, 0xc8, 0x82, 0x5e, 0xab, 0xdd, 0x5c, 0xbb, 0xe9, 0xfc, 0xc0, 0xd6,
+    0xf3, 0xb1, 0x0d, 0xe5, 0xa3, 0xda, 0xca, 0x1f, 0xd0, 0x5c, 0x3e, 0xae, 0xc5, 0x7c, 0x54, 0xa3,
+    0xb9, 0x7e, 0xbb, 0x59, 0x97, 0xb7, 0x3f, 0x46, 0x51, 0xe4, 0xe5, 0x2d, 0x27, 0x94, 0xc2, 0x97,
+    0x75, 0xcb, 0x22, 0xdf, 0xc0, 0xb3, 0xea, 0x03, 0x15, 0xd5, 0x2c, 0x87, 0xea, 0x10, 0xd4, 0xda,
+    0xdb, 0x41, 0x69, 0x3f, 0xe3, 0x47, 0x19, 0x07, 0x6b, 0x95, 0xff, 0x2e, 0xb0, 0x37, 0x77, 0xca,
+    0x0c, 0x0a, 0x34, 0x7f, 0x86, 0xa3, 0x10, 0xfc, 0x98, 0x28, 0x9a, 0xb2, 0x4a, 0x2a, 0xcc, 0xbf,
+    0xfa, 0x15, 0x7a, 0x12, 0xe6, 0x1c, 0x8c, 0x71, 0x50, 0x8c, 0x77, 0xf4, 0x5c, 0x69, 0x68, 0x82,
+    0x1f, 0x4b, 0x5f, 0x31, 0x78, 0x7e, 0xec, 0xbe, 0xaa, 0x33, 0x10, 0xe5, 0xb1, 0x6c, 0x22, 0xad,
+    0x1a, 0xcf, 0xa4, 0xe6, 0xdd, 0xd6, 0xa6, 0x46, 0x0b, 0x76, 0xfc, 0xb3, 0x24, 0xf0, 0x50, 0xfb,
+    0xfc, 0xd5, 0xc5, 0x65, 0x7b, 0x53, 0x8d, 0x8b, 0x0b, 0x24, 0xa8, 0xcf, 0xba, 0x89, 0xda, 0xb2,
+    0x5d, 0x72, 0x2f, 0x6f, 0x52, 0xd2, 0x86, 0x45, 0x38, 0x4d, 0xa3, 0xd0, 0xe7, 0xd7, 0xd7, 0xbd,
+    0x6b, 0x77, 0xb9, 0x5c, 0xba, 0xec, 0xc4, 0xdc, 0x5d, 0x64, 0x11, 0x89, 0x7d, 0xa8, 0x05, 0x81,
+    0x86, 0xf1, 0xae, 0xfc, 0xc8, 0x6e, 0xbd, 0x60, 0x35, 0xf0, 0x72, 0xd0, 0x46, 0x9f, 0x21, 0x01,
+    0xfb, 0xd5, 0x4f, 0xcf, 0x46, 0xc9, 0x1c, 0x0a, 0x3b, 0xbb, 0x92, 0x57, 0x7a, 0xd9, 0xb0, 0x7c,
+    0x68, 0xed, 0xfe, 0xb0, 0xa9, 0x01, 0x28, 0x0a, 0x16, 0x2f, 0x53, 0xed, 0x57, 0x7f, 0xd2, 0xee,
+    0x34, 0x7a, 0x21, 0xeb, 0xc4, 0xe4, 0x1b, 0xa6, 0xc9, 0x22, 0x82, 0xc0, 0x60, 0x1a, 0x0c, 0x9e,
+    0xa0, 0x63, 0xf0, 0x49, 0x9f, 0x00, 0xe1, 0x71, 0x92, 0xd0, 0x6e, 0xb7, 0xcb, 0x8c, 0x21, 0xe1,
+    0xcc, 0xb2, 0x0c, 0x0e, 0x7b, 0x19, 0xce, 0x49, 0xb2, 0xa0, 0x0e, 0xf8, 0x9a, 0xe5, 0xef, 0x08,
+    0xda, 0x77, 0xa1, 0x3a, 0x88, 0x3c, 0xd6, 0xb4, 0x3b, 0x66, 0xdf, 0xb3, 0x89, 0xb6, 0xfb, 0xfd,
+    0xbe, 0xee, 0xe1, 0xd5, 0x14, 0x5a, 0x89, 0x19, 0xd0, 0x2a, 0x28, 0x94, 0xc9, 0x57, 0x1b, 0x23,
+    0x15, 0x6d, 0x36, 0xc6, 0xa3, 0x8e, 0xf9, 0x4b, 0x71, 0x40, 0x2c, 0x3a, 0xb7, 0x1a, 0xcf, 0xab,
+    0x86, 0x1e, 0xdf, 0x18, 0x88, 0xbb, 0x13, 0x7f, 0x46, 0xde, 0x15, 0x7b, 0x14, 0x15, 0x80, 0x66,
+    0x04, 0xd8, 0x61, 0x98, 0x91, 0x29, 0xb9, 0x86, 0x18, 0xec, 0xad, 0x7d, 0xad, 0xd3, 0x2b, 0x58,
+    0x51, 0x1d, 0x22, 0x60, 0x00, 0x87, 0xc8, 0xb9, 0x27, 0x35, 0x67, 0x06, 0x96, 0x56, 0xaa, 0xa9,
+    0xc1, 0xea, 0x91, 0xcb, 0xe6, 0xea, 0x25, 0x6f, 0x6f, 0xd6, 0x6a, 0xab, 0xcc, 0xbd, 0x64, 0x89,
+    0xa2, 0xe8, 0x7d, 0xd6, 0x68, 0x39, 0xad, 0x24, 0x63, 0x63, 0xd2, 0x5b, 0xa3, 0x35, 0x5b, 0xcf,
+    0x07, 0x30, 0x6a, 0xa5, 0x78, 0xbd, 0x16, 0xb4, 0x10, 0xb2, 0x26, 0xff, 0x29, 0xcd, 0xca, 0x04,
+    0x58, 0xc8, 0xbe, 0x4e, 0x9e, 0x63, 0xb0, 0xbc, 0x2e, 0x7f, 0x70, 0x96, 0xe3, 0xdb, 0x98, 0x3f,
+    0x4c, 0x9a, 0x63, 0x7b, 0x8e, 0x55, 0x59, 0xed, 0x8f, 0x2f, 0x5e, 0x7d, 0x09, 0xd5, 0x31, 0x03,
+    0x9f, 0x0f, 0x27, 0x37, 0xce, 0x6d, 0x5d, 0x77, 0xed, 0x29, 0x6f, 0xda, 0xb4, 0xa7, 0x99, 0xd8,
+    0x9e, 0xf2, 0x94, 0xca, 0x74, 0x61, 0x4b, 0xcf, 0x70, 0x81, 0x0a, 0x98, 0xb4, 0x90, 0x07, 0x9d,
+    0x44, 0x96, 0x93, 0x33, 0x48, 0xa8, 0x9a, 0x7d, 0x3b, 0x9b, 0xd5, 0xd2, 0xfc, 0xbf, 0x92, 0x5f,
+    0x8d, 0xa2, 0xfe, 0xff, 0x99, 0xf6, 0x83, 0x32, 0xed, 0x05, 0xac, 0x96, 0x7b, 0x69, 0x2b, 0x91,
+    0x95, 0x68, 0xe7, 0xa0, 0x2e, 0x3c, 0x25, 0x9b, 0xfc, 0x3a, 0xa6, 0x72, 0x9e, 0xcd, 0x61, 0x8e,
+    0xc3, 0xab, 0x55, 0x61, 0x2f, 0x80, 0x4a, 0x3e, 0xd4, 0x22, 0xeb, 0x10, 0x45, 0x52, 0xaa, 0x82,
+    0xf1, 0x4b, 0x82, 0x2f, 0xf1, 0x9c, 0xa5, 0x4f, 0x89, 0x8d, 0xeb, 0x8f, 0x71, 0x54, 0x85, 0x16,
+    0xcd, 0xa5, 0x7c, 0xba, 0xc6, 0x56, 0xf0, 0xc7, 0x6b, 0x6d, 0x3d, 0xd1, 0xdc, 0xff, 0xed, 0xfd,
+    0xbf, 0xbc, 0xff, 0xcd, 0xfd, 0xef, 0xef, 0xff, 0xf3, 0xfe, 0x9f, 0xe1, 0xe7, 0xef, 0xde, 0xff,
+    0xd5, 0xfd, 0xf7, 0xef, 0xff, 0xfc, 0xfe, 0x3f, 0xee, 0x7f, 0x87, 0xd8, 0x8f, 0xf7, 0xbf, 0x7e,
+    0xff, 0xd7, 0xef, 0x7f, 0xf3, 0xfe, 0x6f, 0x10, 0x1f, 0xff, 0xf5, 0xfd, 0xf7, 0xf7, 0xff, 0x8e,
+    0x86, 0x6c, 0xe6, 0x7b, 0x98, 0xfb, 0x8b, 0xfb, 0xff, 0xba, 0xff, 0xd7, 0x8d, 0x07, 0x1d, 0x67,
+    0x05, 0x3f, 0xec, 0x81, 0x5b, 0x79, 0x5a, 0xb7, 0xc9, 0x7e, 0x89, 0xa6, 0x6f, 0x9a, 0xc6, 0xb0,
+    0x85, 0x71, 0xf0, 0x56, 0x3e, 0xcd, 0x2b, 0xb4, 0xfd, 0x67, 0x0b, 0x92, 0xdd, 0x5c, 0xf0, 0x5b,
+    0xd6, 0x24, 0x3b, 0x8a, 0x22, 0xa7, 0x5d, 0x3c, 0x90, 0x82, 0x14, 0x0b, 0x65, 0xf4, 0x04, 0x83,
+    0xe7, 0xb0, 0xd7, 0x3a, 0x06, 0x7b, 0xfc, 0xfd, 0x54, 0x10, 0x9c, 0x5c, 0x01, 0x8a, 0x2f, 0xc2,
+    0x1c, 0x2c, 0x40, 0x32, 0xa7, 0xcd, 0x2f, 0x9e, 0xc0, 0x73, 0xaa, 0x51, 0x90, 0x2f, 0x43, 0xf0,
+    0x40, 0xe0, 0x81, 0xa1, 0xea, 0x32, 0xc7, 0x05, 0xd9, 0x19, 0xa1, 0x9a, 0x26, 0xba, 0xe2, 0x69,
+    0xa5, 0x5b, 0x29, 0x2c, 0xb0, 0xf2, 0x2c, 0x58, 0x5f, 0x1a, 0x79, 0x0d, 0xa5, 0x49, 0x04, 0xa3,
+    0x26, 0x8f, 0x30, 0x20, 0x1c, 0x85, 0x89, 0x03, 0xa1, 0x3a, 0x4f, 0xae, 0x88, 0xd3, 0x16, 0x4f,
+    0x6c, 0xaa, 0x31, 0xf0, 0x51, 0x14, 0xb8, 0x1e, 0xb9, 0x8d, 0xd5, 0x47, 0x82, 0x42, 0x13, 0x1a,
+    0x2e, 0x30, 0x4b, 0x15, 0x51, 0x3d, 0xb7, 0xce, 0xdb, 0xd7, 0xe5, 0x23, 0xa6, 0x4f, 0x6f, 0x39,
+    0xaa, 0xbb, 0xd6, 0x9b, 0xb7, 0x2b, 0xd0, 0x95, 0x41, 0xf0, 0x05, 0x7b, 0x83, 0x57, 0xde, 0xdb,
+    0x25, 0x6c, 0xf3, 0xb6, 0x9c, 0x85, 0x11, 0x41, 0x21, 0xcd, 0x99, 0x3a, 0xa1, 0xd1, 0x42, 0x49,
+    0x4a, 0x62, 0xad, 0x12, 0x73, 0x0a, 0x22, 0x39, 0x1b, 0x77, 0x86, 0x46, 0x9e, 0x06, 0xd7, 0xcf,
+    0xa8, 0x7a, 0x27, 0x55, 0xa6, 0xcb, 0xea, 0x35, 0x02, 0x4d, 0xd2, 0x3a, 0x38, 0x2b, 0x4b, 0x99,
+    0x8c, 0x7a, 0xe2, 0x6d, 0x4d, 0x98, 0x41, 0xfa, 0x21, 0xcc, 0x7d, 0xd1, 0x0c, 0xe7, 0x62, 0x0c,
+    0x92, 0x3f, 0x8f, 0x3b, 0x96, 0xac, 0xa0, 0xbe, 0x08, 0x91, 0xc4, 0x65, 0x60, 0x80, 0xf8, 0xc5,
+    0x6e, 0xae, 0xee, 0xf3, 0x14, 0xbe, 0x8b, 0x64, 0x91, 0xf9, 0x2c, 0xb3, 0xc4, 0xb0, 0xbc, 0xbc,
+    0xef, 0x2b, 0x6e, 0x37, 0x61, 0xe2, 0xb6, 0x38, 0xb8, 0x2e, 0xfd, 0xd8, 0x92, 0x50, 0xc9, 0xc4,
+    0x75, 0x64, 0x62, 0xee, 0x58, 0x3d, 0x47, 0x0d, 0x61, 0x76, 0xc6, 0xc9, 0x24, 0x11, 0x23, 0xd0,
+    0x86, 0x70, 0xb9, 0xb4, 0x8c, 0x69, 0xad, 0xa9, 0x89, 0x5c, 0x05, 0x01, 0xd1, 0x6b, 0x1d, 0xb5,
+    0xf2, 0x9e, 0x82, 0x97, 0x72, 0x87, 0xf0, 0xc8, 0x2d, 0xbd, 0x7a, 0x91, 0xf2, 0x76, 0xcb, 0x8a,
+    0xf5, 0x42, 0xf4, 0xd7, 0x62, 0xba, 0x9b, 0xdf, 0x00, 0x95, 0xf9, 0xb7, 0x61, 0xf0, 0x06, 0x98,
+    0x7d, 0x35, 0xfe, 0x8e, 0xbd, 0x46, 0x07, 0xef, 0x0a, 0xa7, 0xb1, 0xb3, 0x02, 0x14, 0xf6, 0xaa,
+    0xb7, 0x90, 0xdc, 0xc4, 0x44, 0x6d, 0x96, 0x10, 0xd5, 0xab, 0xce, 0x01, 0x9a, 0xd2, 0x87, 0xe9,
+    0x2f, 0x86, 0xd6, 0x9f, 0x3c, 0x4e, 0xed, 0x10, 0x20, 0x09, 0x28, 0xa4, 0xb3, 0xc2, 0x2a, 0xca,
+    0x1d, 0x90, 0xed, 0x0c, 0xb5, 0xbc, 0x99, 0xa2, 0x58, 0x75, 0xb2, 0x7c, 0xc5, 0xbe, 0xa2, 0x4e,
+    0x16, 0x54, 0x8c, 0x0b, 0x5b, 0xb1, 0xac, 0x1b, 0x42, 0xef, 0x95, 0xb1, 0xdf, 0x01, 0x65, 0x05,
+    0x44, 0x15, 0x0f, 0x69, 0x0c, 0xde, 0x48, 0xe7, 0xca, 0x18, 0xa5, 0x7d, 0xaf, 0x4c, 0xd3, 0x0a,
+    0x5e, 0xd8, 0x03, 0x76, 0x26, 0xc9, 0xeb, 0xb7, 0x17, 0xdc, 0x5a, 0xe8, 0xd3, 0xdb, 0xab, 0xd2,
+    0x70, 0x77, 0x88, 0x7f, 0x87, 0x8d, 0xcf, 0xdd, 0xdb, 0x37, 0x7b, 0x46, 0x63, 0x76, 0xd5, 0x9d,
+    0x44, 0xec, 0xf5, 0xb1, 0xbc, 0xd9, 0xe6, 0x78, 0xba, 0xe9, 0x22, 0x9f, 0x39, 0x6f, 0xf9, 0xde,
+    0x86, 0xff, 0x61, 0x8b, 0x35, 0x30, 0xe3, 0x3c, 0x5e, 0x20, 0x19, 0xf3, 0x77, 0x77, 0x37, 0x26,
+    0x82, 0x17, 0x62, 0x50, 0x22, 0x90, 0x20, 0xdd, 0xab, 0x24, 0xa2, 0xd0, 0x11, 0x74, 0x69, 0x72,
+    0x1a, 0x5e, 0x93, 0xc0, 0xd9, 0xea, 0xdc, 0xa1, 0x9f, 0x99, 0x20, 0xf2, 0xee, 0xc1, 0x00, 0x39,
+    0x32, 0x41, 0x20, 0x39, 0x83, 0x12, 0xa1, 0x4d, 0xbc, 0x7b, 0x5a, 0xe5, 0x06, 0x60, 0x42, 0xba,
+    0xd0, 0x6f, 0xea, 0x4b, 0x4d, 0x05, 0x64, 0x0a, 0x7a, 0xe2, 0x1d, 0x97, 0x93, 0xa1, 0x3f, 0x42,
+    0x5b, 0xcf, 0xfb, 0x08, 0xb6, 0xa7, 0x98, 0xce, 0xba, 0xe7, 0x67, 0x1d, 0x8d, 0xa4, 0xde, 0x10,
+    0xea, 0x52, 0x1d, 0x49, 0xe4, 0x08, 0x9d, 0x03, 0x47, 0x80, 0x4e, 0x23, 0xd8, 0x4d, 0x59, 0x2d,
+    0x04, 0x6e, 0xd1, 0x4f, 0xab, 0x73, 0x59, 0x12, 0x45, 0x6c, 0xea, 0xe7, 0xd5, 0xa9, 0x1b, 0xbc,
+    0xec, 0x18, 0x5a, 0xbd, 0xb3, 0x24, 0x9a, 0xa6, 0xb9, 0xa9, 0xdb, 0x1f, 0x9f, 0x5f, 0xa0, 0xd2,
+    0x38, 0x30, 0xdd, 0x65, 0xef, 0xd9, 0x39, 0xb2, 0x42, 0x84, 0x67, 0x40, 0x4c, 0x4d, 0x26, 0xb0,
+    0xf9, 0xa8, 0xcc, 0xaa, 0x69, 0x1c, 0x59, 0x6b, 0xfb, 0x30, 0x3b, 0x2f, 0xe7, 0x73, 0x08, 0xf7,
+    0x28, 0x0a, 0x61, 0xfb, 0x7c, 0x07, 0x8d, 0x38, 0xd5, 0x39, 0x95, 0x5a, 0x35, 0xbb, 0x45, 0x3f,
+    0x23, 0xb0, 0x42, 0x06, 0x82, 0xd3, 0x86, 0x59, 0xbd, 0x15, 0x0e, 0xec, 0xf6, 0x4f, 0x3a, 0x79,
+    0xdb, 0x04, 0x31, 0x1b, 0x49, 0x21, 0xfc, 0x77, 0x49, 0x18, 0x3b, 0xed, 0x3f, 0x8d, 0xdb, 0x26,
+    0x07, 0x32, 0xa0, 0x60, 0x57, 0x46, 0xe2, 0x60, 0x04, 0xf5, 0x2e, 0x70, 0x00, 0x43, 0x5d, 0xee,
+    0x51, 0x5d, 0x32, 0xeb, 0xbf, 0x30, 0x94, 0xdb, 0x9c, 0xff, 0xf6, 0xc4, 0x24, 0x8c, 0xa2, 0x8d,
+    0x35, 0x2e, 0xf9, 0xaa, 0x49, 0x9a, 0xbf, 0x6b, 0x82, 0x04, 0xad, 0x6e, 0x57, 0x35, 0xaf, 0xe3,
+    0x35, 0xa7, 0xb8, 0xd2, 0x86, 0x06, 0x24, 0x03, 0xa4, 0x72, 0xc7, 0x0d, 0xfd, 0x1f, 0x7b, 0xdb,
+    0xea, 0xf4, 0x5e, 0xff, 0xa2, 0x3c, 0xb9, 0xe8, 0x4d, 0xa1, 0xc1, 0x67, 0xf7, 0x90, 0xc9, 0x57,
+    0x20, 0x49, 0x36, 0xc2, 0x7a, 0x36, 0xe3, 0x8e, 0xc0, 0xd7, 0x46, 0x24, 0x9e, 0xd2, 0x19, 0x3a,
+    0x44, 0x5b, 0x83, 0x8e, 0xc2, 0x2f, 0xa6, 0xf2, 0xc5, 0x18, 0x76, 0x9a, 0x4e, 0x7f, 0x93, 0xcd,
+    0xed, 0x6d, 0x6c, 0x68, 0x8c, 0x88, 0xd3, 0x17, 0x4a, 0x02, 0x23, 0xdb, 0xc0, 0x28, 0x72, 0xd8,
+    0x74, 0x08, 0xc3, 0xfd, 0x3d, 0xf8, 0xb1, 0x8f, 0x74, 0x2a, 0x30, 0xf2, 0xd9, 0x67, 0x1d, 0x6b,
+    0x37, 0x17, 0x02, 0xed, 0x3e, 0xfa, 0xd1, 0x8f, 0x00, 0xfa, 0x29, 0x1a, 0xf0, 0xd6, 0xa1, 0x6f,
+    0xc6, 0x5a, 0x49, 0xec, 0x33, 0xa0, 0xe6, 0xb5, 0xeb, 0x3c, 0xdb, 0x80, 0xe1, 0x34, 0x5f, 0x87,
+    0x6f, 0x2a, 0xbb, 0x78, 0x53, 0x6f, 0xec, 0x24, 0xba, 0x58, 0x26, 0x6d, 0xca, 0x15, 0xb4, 0xdf,
+    0x2b, 0x9e, 0x11, 0xed, 0xf7, 0xc4, 0x0b, 0xfa, 0xfd, 0x9e, 0xf8, 0xb5, 0xfa, 0xff, 0x01, 0x2b,
+    0x0f, 0x08, 0x79, 0x6e, 0x3f, 0x00, 0x00,
+};
+
+#endif
@@ -1,525 +1,43 @@
-﻿#include <WebServer.h>
+﻿#include <ESPAsyncWebServer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <ArduinoJson.h>
 #include "config.h"
-
-static WebServer server(80);
-
-// HTML page to input MAC-Address
-const char htmlPage[] PROGMEM = R"rawliteral(
-<!DOCTYPE HTML>
-<html>
-<head>
-  <title>ESP32 setup</title>
-  <meta charset="UTF-8">
-  <style>
-    body {
-      font-family: Arial, sans-serif;
-      max-width: 500px;
-      margin: 50px auto;
-      padding: 20px;
-      background-color: #f5f5f5;
-      height: auto;
-    }
-    .container {
-      background: white;
-      padding: 20px;
-      border-radius: 10px;
-      box-shadow: 0 2px 10px rgba(0,0,0,0.1);
-      height: auto;
-      min-height: auto;
-    }
-    h2 {
-      color: #333;
-      text-align: center;
-      margin-bottom: 30px;
-    }
-    .input-group {
-      margin-bottom: 20px;
-    }
-    label {
-      display: block;
-      margin-bottom: 8px;
-      font-weight: bold;
-      color: #555;
-    }
-    input {
-      width: 200px;
-      padding: 4px;
-      border: 2px solid #ddd;
-      border-radius: 4px;
-      font-size: 12px;
-      font-family: monospace;
-      letter-spacing: 1px;
-    }
-    input:focus {
-      border-color: #4CAF50;
-      outline: none;
-    }
-    .mac-example {
-      font-size: 14px;
-      color: #666;
-      margin-top: 5px;
-      font-family: monospace;
-    }
-    .button-group {
-      display: flex;
-      gap: 10px;
-      margin-top: 30px;
-    }
-    button {
-      flex: 1;
-      padding: 14px;
-      border: none;
-      border-radius: 6px;
-      font-size: 16px;
-      font-weight: bold;
-      cursor: pointer;
-      transition: background 0.3s;
-    }
-    .btn-save {
-      background: #4CAF50;
-      color: white;
-    }
-    .btn-save:hover {
-      background: #45a049;
-    }
-    .btn-current {
-      background: #2196F3;
-      color: white;
-    }
-    .btn-current:hover {
-      background: #0b7dda;
-    }
-    .status {
-      margin-top: 20px;
-      padding: 15px;
-      border-radius: 6px;
-      text-align: center;
-      display: none;
-    }
-    .success {
-      background: #d4edda;
-      color: #155724;
-      border: 1px solid #c3e6cb;
-    }
-    .error {
-      background: #f8d7da;
-      color: #721c24;
-      border: 1px solid #f5c6cb;
-    }
-    .info-box {
-      background: #e3f2fd;
-      border-left: 4px solid #2196F3;
-      padding: 15px;
-      margin-bottom: 25px;
-      border-radius: 4px;
-    }
-    .current-mac {
-      font-family: monospace;
-      background: #f8f9fa;
-      padding: 10px;
-      border-radius: 4px;
-      margin: 10px 0;
-      font-weight: bold;
-      text-align: center;
-      font-size: 18px;
-      color: #333;
-    }
-    .input-row {
-      display: flex;
-      align-items: center;
-      gap: 10px;
-      margin-bottom: 5px;
-    }
-    label {
-      min-width: 80px;
-    }
-
-    .wifi-input, select.wifi-input {
-      width: 200px;
-      padding: 4px;
-      border: 2px solid #ddd;
-      border-radius: 4px;
-      font-size: 12px;
-      font-family: monospace;
-      letter-spacing: 1px;
-      box-sizing: border-box !important;
-    }
-
-    .tabs-container {
-      width: 100%;
-      background: white;
-      overflow: hidden;
-    }
-
-    .tabs-header {
-      display: flex;
-      background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-      border-bottom: 1px solid #ddd;
-    }
-
-    .tab-content {
-      display: none;
-      animation: fadeIn 0.5s ease-in-out;
-      height: auto;
-    }
-
-    .tab-content.active {
-      display: block;
-    }
-
-    .tab-btn {
-      flex: 1;
-      padding: 15px 10px;
-      background: none;
-      border: none;
-      color: white;
-      font-size: 14px;
-      font-weight: 600;
-      cursor: pointer;
-      transition: all 0.3s ease;
-      position: relative;
-    }
-
-    .tab-btn::after {
-      content: '';
-      position: absolute;
-      bottom: 0;
-      left: 50%;
-      width: 0;
-      height: 3px;
-      background: #ffeb3b;
-      transition: all 0.3s ease;
-      transform: translateX(-50%);
-    }
-
-    .tab-btn:hover {
-      background: rgba(255,255,255,0.1);
-    }
-
-    .tab-btn.active {
-      background: rgba(255,255,255,0.15);
-    }
-
-    .tab-btn.active::after {
-      width: 80%;
-    }
-
-  </style>
-</head>
-
-<body>
-  <div class="container">
-    <div class="tabs-container">
-      <div class="tabs-header">
-        <button class="tab-btn active" data-tab="mac-tab" id="mac-tab-btn">🔧 MAC-Address</button>
-        <button class="tab-btn" data-tab="wifi-tab" id="wifi-tab-btn">📶 WIFI</button>
-      </div>
-
-      <div id="mac-tab" class="tab-content active">
-        <div class="info-box">
-          <strong>Current ESP32 MAC-Address:</strong>
-          <div id="currentMac" class="current-mac">Load...</div>
-        </div>
-
-        <div class="input-group">
-          <label for="mac">New ESP32 MAC-Address:</label>
-          <input type="text" id="mac" name="mac"
-                 placeholder="AA:BB:CC:DD:EE:FF"
-                 pattern="^([0-9A-Fa-f]{2}[:-]){5}([0-9A-Fa-f]{2})$"
-                 title="Enter the MAC in the format XX:XX:XX:XX:XX:XX">
-          <div class="mac-example">Format: AA:BB:CC:DD:EE:FF or AA-BB-CC-DD-EE-FF</div>
-        </div>
-
-        <div class="button-group">
-          <button class="btn-save" onclick="saveMac()">💾 Save MAC</button>
-          <button class="btn-current" onclick="getCurrentMac()">🔄 Current MAC</button>
-        </div>
-      </div>
-
-      <div id="wifi-tab" class="tab-content">
-        <div class="input-group">
-          <div class="input-row">
-            <label for="wifi_mode">WiFi Mode</label>
-            <select class="wifi-input" id="wifi_mode" onchange="wifiModeChange(this.value)">
-              <option value="ap">WiFi Access Point</option>
-              <option value="sta">WiFi Client (Connect to network)</option>
-            </select>
-          </div>
-          <div class="input-row">
-            <label for="wifi_ssid">SSID</label>
-            <input class="wifi-input" type="text" id="wifi_ssid"
-                   title="WIFI SSID">
-          </div>
-          <div class="input-row">
-            <label for="wifi_password">Password</label>
-            <input class="wifi-input" type="text" id="wifi_password"
-                   title="WIFI password">
-          </div>
-          <div class="input-row">
-            <label for="wifi_channel">Channel</label>
-            <input class="wifi-input" type="text" id="wifi_channel"
-                   title="WIFI channel">
-          </div>
-          <div class="button-group">
-            <button class="btn-save" onclick="saveWifi()">💾 Save WIFI</button>
-            <button class="btn-current" onclick="getCurrentWifi()">🔄 Current WIFI</button>
-          </div>
-        </div>
-      </div>
-      <div id="status" class="status"></div>
-    </div>
-  </div>
-
-  <script>
-
-    // Disable ssid, password change in AP mode
-    let externalSSID = "";
-    let externalPassword = "";
-    let apChannel = "1";
-    function wifiModeChange(wifi_mode) {
-      const ssid_elem = document.getElementById('wifi_ssid');
-      const password_elem = document.getElementById('wifi_password');
-      const channel_elem = document.getElementById('wifi_channel');
-
-      if (wifi_mode === "ap") {
-        externalSSID = ssid_elem.value;
-        ssid_elem.value = "mavlink";
-        ssid_elem.readOnly = true;
-        ssid_elem.style.cursor = 'not-allowed';
-
-        externalPassword = password_elem.value;
-        password_elem.value = "12345678";
-        password_elem.readOnly = true;
-        password_elem.style.cursor = 'not-allowed';
-
-        channel_elem.value = apChannel;
-        channel_elem.readOnly = false;
-        channel_elem.style.cursor = 'text';
-
-      } else {
-        ssid_elem.value = externalSSID;
-        ssid_elem.readOnly = false;
-        ssid_elem.style.cursor = 'text';
-
-        password_elem.value = externalPassword;
-        password_elem.readOnly = false;
-        password_elem.style.cursor = 'text';
-
-        apChannel = channel_elem.value;
-        channel_elem.value = "1";
-        channel_elem.readOnly = true;
-        channel_elem.style.cursor = 'not-allowed';
-      }
-    }
-
-    // Get current MAC by page loading
-    window.onload = function() {
-      prepareTabs();
-      getCurrentMac();
-      getCurrentWifi();
-    };
-
-    // Get MAC from server
-    function getCurrentMac() {
-      fetch('/current_mac')
-        .then(response => response.text())
-        .then(data => {
-          document.getElementById('currentMac').textContent = data;
-          document.getElementById('mac').value = data;
-        })
-        .catch(error => {
-          showStatus('Error retrieving MAC address', 'error');
-        });
-    }
-
-    // Get WIFI from server
-    function getCurrentWifi() {
-      fetch('/current_wifi')
-        .then(response => {
-          if (!response.ok) {
-            throw new Error(`HTTP error! status: ${response.status}`);
-          }
-          return response.json();
-        })
-        .then(data => {
-          const ssid_elem = document.getElementById('wifi_ssid');
-          const password_elem = document.getElementById('wifi_password');
-          const channel_elem = document.getElementById('wifi_channel');
-          const wifi_mode_elem = document.getElementById('wifi_mode');
-
-          wifi_mode_elem.value = data.wifi_mode;
-
-          if (data.wifi_mode === "sta") {
-            externalSSID = data.wifi_ssid;
-            externalPassword = data.wifi_password;
-
-            ssid_elem.value = data.wifi_ssid;
-            ssid_elem.readOnly = false;
-            ssid_elem.style.cursor = 'text';
-
-            password_elem.value = data.wifi_password;
-            password_elem.readOnly = false;
-            password_elem.style.cursor = 'text';
-
-            channel_elem.value = "1";
-            channel_elem.readOnly = true;
-            channel_elem.style.cursor = 'not-allowed';
-          } else {
-              apChannel = data.wifi_channel;
-
-              ssid_elem.value = "mavlink";
-              ssid_elem.readOnly = true;
-              ssid_elem.style.cursor = 'not-allowed';
-
-              password_elem.value = "12345678";
-              password_elem.readOnly = true;
-              password_elem.style.cursor = 'not-allowed';
-
-              channel_elem.value = apChannel;
-              channel_elem.readOnly = false;
-              channel_elem.style.cursor = 'text';
-          }
-        })
-        .catch(error => {
-          showStatus('Error retrieving WIFI settings', 'error');
-        });
-    }
-
-    // Save new MAC
-    function saveMac() {
-      const macInput = document.getElementById('mac').value.trim();
-
-      // Validate MAC
-      if (!macInput || !isValidMac(macInput)) {
-        showStatus('Enter valid MAC-address', 'error');
-        return;
-      }
-
-      fetch('/save_mac', {
-        method: 'POST',
-        headers: {
-          'Content-Type': 'application/x-www-form-urlencoded',
-        },
-        body: 'mac=' + encodeURIComponent(macInput)
-      })
-      .then(response => response.text())
-      .then(data => {
-        if (data === 'OK') {
-          showStatus('MAC successfully saved! Device reboot...', 'success');
-          setTimeout(() => {
-            location.reload();
-          }, 3000);
-        } else {
-          showStatus('Error: ' + data, 'error');
-        }
-      })
-      .catch(error => {
-        showStatus('Network error', 'error');
-      });
-    }
-
-    // MAC format cheking
-    function isValidMac(mac) {
-      const regex = /^([0-9A-Fa-f]{2}[:-]){5}([0-9A-Fa-f]{2})$/;
-      return regex.test(mac);
-    }
-
-    // Save new WIFI
-    function saveWifi() {
-      const wifiMode = document.getElementById('wifi_mode').value;
-      const wifiSSID = document.getElementById('wifi_ssid').value.trim();
-      const wifiPassword = document.getElementById('wifi_password').value.trim();
-      const wifiChannel = document.getElementById('wifi_channel').value;
-
-      // Validate WIFI
-      if (!wifiSSID) {
-        showStatus('Enter valid wifi ssid', 'error');
-        return;
-      }
-
-      fetch('/save_wifi', {
-        method: 'POST',
-        headers: {
-          'Content-Type': 'application/json',
-        },
-        body: JSON.stringify({
-          wifi_mode: wifiMode,
-          wifi_ssid: wifiSSID,
-          wifi_password: wifiPassword,
-          wifi_channel: parseInt(wifiChannel),
-        })
-      })
-      .then(response => response.text())
-      .then(data => {
-        if (data === 'OK') {
-          showStatus('WIFI settings successfully saved! Device reboot...', 'success');
-          setTimeout(() => {
-            location.reload();
-          }, 3000);
-        } else {
-          showStatus('Error: ' + data, 'error');
-        }
-      })
-      .catch(error => {
-        showStatus('Network error', 'error');
-      });
-    }
-
-    // Show status
-    function showStatus(message, type) {
-      const statusDiv = document.getElementById('status');
-      statusDiv.textContent = message;
-      statusDiv.className = 'status ' + type;
-      statusDiv.style.display = 'block';
-
-      // Автоматически скрыть через 5 секунд
-      setTimeout(() => {
-        statusDiv.style.display = 'none';
-      }, 5000);
-    }
-
-        function prepareTabs() {
-      document.querySelectorAll('.tab-btn').forEach(btn => {
-        btn.addEventListener('click', () => {
-          switchTab(btn.dataset.tab);
-        });
-      });
-    }
-
-    function switchTab(tabId) {
-      document.querySelectorAll('.tab-content').forEach(tab => {
-        tab.classList.remove('active');
-      });
-      document.querySelectorAll('.tab-btn').forEach(btn => {
-        btn.classList.remove('active');
-      });
-
-      document.getElementById(tabId).classList.add('active');
-      document.querySelector(`[data-tab="${tabId}"]`).classList.add('active');
-    }
-
-
-    // Separators autofill
-    document.getElementById('mac').addEventListener('input', function(e) {
-      let value = e.target.value.replace(/[^0-9A-Fa-f]/g, '').toUpperCase();
-      if (value.length > 12) value = value.substr(0, 12);
-
-
-      let formatted = '';
-      for (let i = 0; i < value.length; i++) {
-        if (i > 0 && i % 2 === 0) {
-          formatted += ':';
-        }
-        formatted += value[i];
-      }
-
-      e.target.value = formatted;
-    });
-  </script>
-</body>
-</html>
-)rawliteral";
+#include "web-server.h"
+#include "web-page.h"
+#include "vehicles.h"
+#include "telemetry-json.h"
+#include "capture.h"
+#include "trace.h"
+
+// Requests are served from the AsyncTCP task, the Arduino loop only reboots
+static AsyncWebServer server(80);
+static AsyncEventSource events("/events");
+static uint32_t rebootAt = 0;
+
+// Live telemetry push. A client with an unsent event gets nothing new,
+// it is marked stale and receives the full state once it has drained.
+struct PushClient_t {
+  AsyncEventSourceClient* client;
+  bool stale;
+};
+
+// What was pushed last, to send only the groups that changed
+struct PushedTelemetry_t {
+  bool valid;
+  decltype(TelemetryData_t::battery) battery;
+  decltype(TelemetryData_t::attitude) attitude;
+  decltype(TelemetryData_t::flightMode) flightMode;
+  decltype(TelemetryData_t::gps) gps;
+};
+
+static PushClient_t pushClients[MAX_PUSH_CLIENTS];
+static SemaphoreHandle_t pushLock;   // clients are added in the AsyncTCP task
+static PushedTelemetry_t pushed[MAX_VEHICLES];
+static char pushDelta[MAX_VEHICLES * PUSH_VEHICLE_JSON_MAX];
+static char pushFull[MAX_VEHICLES * PUSH_VEHICLE_JSON_MAX];
+static uint32_t pushId = 0;
+static uint32_t lastPush = 0;
 
 // MAC string parsing
 bool parseMacAddress(const char* macStr, uint8_t* mac) {
@@ -548,68 +66,91 @@ bool parseMacAddress(const char* macStr, uint8_t* mac) {
 }
 
 // Main page load handler
-void handleRoot() {
-  server.send(200, "text/html", htmlPage);
+// The page is stored gzipped in flash; a browser holding the same ETag gets 304
+void handleRoot(AsyncWebServerRequest *request) {
+  AsyncWebServerResponse *response;
+  if (request->hasHeader("If-None-Match") &&
+      request->getHeader("If-None-Match")->value().indexOf(HTML_PAGE_ETAG) >= 0) {
+    response = request->beginResponse(304);
+  } else {
+    response = request->beginResponse(200, "text/html", htmlPageGz, sizeof(htmlPageGz));
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", HTML_PAGE_ETAG);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
 }
 
 // Handler to obtain the current MAC
-void handleCurrentMac() {
-  String currentMac = macToString(config.customMAC);
-  server.send(200, "text/plain", currentMac);
+void handleCurrentMac(AsyncWebServerRequest *request) {
+  request->send(200, "text/plain", macToString(config.customMAC));
 }
 
 // Handler to obtain the current WIFI
-void handleCurrentWifi() {
+void handleCurrentWifi(AsyncWebServerRequest *request) {
   JsonDocument doc;
   doc["wifi_ssid"] = config.wifiSSID;
   doc["wifi_password"] = config.wifiPassword;
   doc["wifi_mode"] = config.wifiMode == AP_WIFI_MODE ? "ap" : "sta";
   doc["wifi_channel"] = config.wifiChannel;
-  String response;
-  serializeJson(doc, response);
-  server.send(200, "application/json", response);
+  char response[128];
+  serializeJson(doc, response, sizeof(response));
+  request->send(200, "application/json", response);
 }
 
+// The reply has to leave before the reboot, so it is done from webServerRun
 void safeReboot() {
-    Serial.println("ESP32 Device reboot...");
-
-    // 1. close all connections
-    server.stop();
-
-    // 2. Wait
-    delay(500);
-
-    // 3. Reboot
-    ESP.restart();
+  rebootAt = millis() + WEB_REBOOT_DELAY_MS;
+  if (rebootAt == 0) rebootAt = 1;
 }
 
 // Handler for storing MAC
-void handleSaveMac() {
-  if (server.hasArg("mac")) {
-    String macStr = server.arg("mac");
-    Serial.printf(macStr.c_str());
+void handleSaveMac(AsyncWebServerRequest *request) {
+  if (request->hasParam("mac", true)) {
+    const String& macStr = request->getParam("mac", true)->value();
 
     if (parseMacAddress(macStr.c_str(), config.customMAC)) {
       saveMacToStorage();
 
-      server.send(200, "text/plain", "OK");
+      request->send(200, "text/plain", "OK");
       Serial.println("New MAC saved: " + macStr);
       safeReboot();
     } else {
-      server.send(400, "text/plain", "Wrong MAC format");
+      request->send(400, "text/plain", "Wrong MAC format");
     }
   } else {
-    server.send(400, "text/plain", "MAC is not specified");
+    request->send(400, "text/plain", "MAC is not specified");
   }
 }
 
-// Handler for storing WIFI
-#include <ArduinoJson.h>
+// Collects the JSON body of /save_wifi, bounded by WEB_BODY_MAX_LEN.
+// The buffer is owned by the request and freed with it.
+void collectBody(AsyncWebServerRequest *request, uint8_t *data, size_t len, size_t index, size_t total) {
+  if (total > WEB_BODY_MAX_LEN) return;
 
-void handleSaveWifi() {
-  String body = server.arg("plain"); // Получаем сырое тело запроса
+  if (index == 0) {
+    request->_tempObject = malloc(total + 1);
+  }
+  char* body = (char*)request->_tempObject;
+  if (body == NULL || index + len > total) return;
 
-  Serial.println("Received body: " + body);
+  memcpy(body + index, data, len);
+  body[index + len] = 0;
+}
+
+// Handler for storing WIFI
+void handleSaveWifi(AsyncWebServerRequest *request) {
+  const char* body = (const char*)request->_tempObject;
+  if (body == NULL) {
+    if (request->contentLength() > WEB_BODY_MAX_LEN) {
+      request->send(413, "text/plain", "Body is too large");
+    } else {
+      request->send(400, "text/plain", "Invalid JSON");
+    }
+    return;
+  }
+
+  Serial.printf("Received body: %s\n", body);
 
   // Parse JSON
   JsonDocument doc;
@@ -618,24 +159,24 @@ void handleSaveWifi() {
   if (error) {
     Serial.print("JSON parse failed: ");
     Serial.println(error.c_str());
-    server.send(400, "text/plain", "Invalid JSON");
+    request->send(400, "text/plain", "Invalid JSON");
     return;
   }
 
   // Get values
-  if (doc["wifi_ssid"].is<String>()) {
+  if (doc["wifi_ssid"].is<const char*>()) {
     const char* ssid = doc["wifi_ssid"];
     Serial.printf("SSID: %s\n", ssid);
-    strcpy(config.wifiSSID, ssid);
+    strlcpy(config.wifiSSID, ssid, sizeof(config.wifiSSID));
   }
 
-  if (doc["wifi_password"].is<String>()) {
+  if (doc["wifi_password"].is<const char*>()) {
     const char* password = doc["wifi_password"];
     Serial.printf("Password: %s\n", password);
-    strcpy(config.wifiPassword, password);
+    strlcpy(config.wifiPassword, password, sizeof(config.wifiPassword));
   }
 
-  if (doc["wifi_mode"].is<String>()) {
+  if (doc["wifi_mode"].is<const char*>()) {
     const char* modeParam = doc["wifi_mode"];
     Serial.printf("Mode: %s\n", modeParam);
 
@@ -655,13 +196,13 @@ void handleSaveWifi() {
 
   saveWifiToStorage();
 
-  server.send(200, "text/plain", "OK");
+  request->send(200, "text/plain", "OK");
   Serial.println("New WIFI settings are saved");
   safeReboot();
 }
 
 // Handler for resetting to factory MAC
-void handleReset() {
+void handleReset(AsyncWebServerRequest *request) {
   // Getting the factory MAC
   uint8_t factoryMac[6];
   esp_efuse_mac_get_default(factoryMac);
@@ -670,26 +211,249 @@ void handleReset() {
   saveMacToStorage();
   //esp_base_mac_addr_set(config.customMAC);
 
-  server.send(200, "text/plain", "MAC reset to factory settings completed");
+  request->send(200, "text/plain", "MAC reset to factory settings completed");
   safeReboot();
 }
 
 // Handler for WiFi information
-void handleInfo() {
-  String info = "<html><body>";
-  info += "<h2>Device information</h2>";
-  info += "<p><strong>Current MAC:</strong> " + macToString(config.customMAC) + "</p>";
-
+void handleInfo(AsyncWebServerRequest *request) {
   uint8_t factoryMac[6];
   esp_efuse_mac_get_default(factoryMac);
-  info += "<p><strong>Factory MAC:</strong> " + macToString(factoryMac) + "</p>";
 
-  info += "<p><strong>IP address:</strong> " + WiFi.localIP().toString() + "</p>";
-  info += "<p><strong>MAC WiFi:</strong> " + WiFi.macAddress() + "</p>";
-  info += "<br><p><a href='/'>Go back to settings</a></p>";
-  info += "</body></html>";
+  char info[512];
+  snprintf(info, sizeof(info),
+    "<html><body>"
+    "<h2>Device information</h2>"
+    "<p><strong>Current MAC:</strong> %s</p>"
+    "<p><strong>Factory MAC:</strong> %s</p>"
+    "<p><strong>IP address:</strong> %s</p>"
+    "<p><strong>MAC WiFi:</strong> %s</p>"
+    "<br><p><a href='/'>Go back to settings</a></p>"
+    "</body></html>",
+    macToString(config.customMAC).c_str(), macToString(factoryMac).c_str(),
+    WiFi.localIP().toString().c_str(), WiFi.macAddress().c_str());
+
+  request->send(200, "text/html", info);
+}
+
+// Live telemetry of all vehicles as {"vehicles":[...]}.
+// Every chunk is one vehicle serialized from a snapshot on the stack, so the
+// JSON output itself is heap-free. The response object and the std::function
+// holding the chunk callback are still heap-allocated once per request.
+void handleTelemetry(AsyncWebServerRequest *request) {
+  int slot = 0;       // next vehicle table slot
+  int records = 0;    // vehicles already sent
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse("application/json",
+    [slot, records](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+      char chunk[TELEMETRY_JSON_MAX_LEN + 16];
+      TelemetryData_t telemetry;
+      int length = index == 0 ? snprintf(chunk, sizeof(chunk), "{\"vehicles\":[") : 0;
+      int next = slot;
+      bool record = false;
+
+      while (next <= MAX_VEHICLES && !record) {
+        if (next == MAX_VEHICLES) {
+          length += snprintf(chunk + length, sizeof(chunk) - length, "]}");
+          break;
+        }
+        if (!vehicleSnapshot(next, &telemetry)) {
+          next++;
+          continue;
+        }
+
+        Vehicle_t* vehicle = vehicleAt(next);
+        int start = length;
+        if (records > 0) {
+          chunk[length++] = ',';
+        }
+        int written = telemetryToJson(&telemetry, vehicle->systemId, vehicle->mac,
+                                      TELEMETRY_ALL | TELEMETRY_JSON_STATISTIC,
+                                      chunk + length, sizeof(chunk) - length);
+        if (written < 0) {
+          // Does not fit: leave the vehicle out
+          length = start;
+          next++;
+          continue;
+        }
+        length += written;
+        record = true;
+      }
+      if (next > MAX_VEHICLES) return 0;
+
+      // Wait for the TCP window instead of splitting a record
+      if ((size_t)length > maxLen) return RESPONSE_TRY_AGAIN;
+
+      memcpy(buffer, chunk, length);
+      slot = next + 1;
+      if (record) records++;
+      return length;
+    });
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+}
+
+// Starts recording the received ESP-NOW frames
+void handleCaptureStart(AsyncWebServerRequest *request) {
+  if (!captureStart()) {
+    request->send(503, "text/plain", "Capture download in progress or out of memory");
+    return;
+  }
+  request->send(200, "text/plain", "OK");
+}
+
+// Stops recording and downloads the capture for the host replay.
+// The response reads the buffer as the TCP window opens, so it is only
+// released when the client is gone.
+void handleCapture(AsyncWebServerRequest *request) {
+  uint32_t length;
+  const uint8_t* capture = captureStop(&length);
+  if (capture == NULL) {
+    request->send(409, "text/plain", "Capture download in progress");
+    return;
+  }
+  request->onDisconnect(captureRelease);
+
+  AsyncWebServerResponse *response = request->beginResponse(200, "application/octet-stream", capture, length);
+  response->addHeader("Content-Disposition", "attachment; filename=\"espnow.cap\"");
+  request->send(response);
+}
+
+// Latency histograms of the frame stages, as HdrHistogram percentile text.
+// Written line by line straight into the TCP buffer.
+void handleLatency(AsyncWebServerRequest *request) {
+  TraceReport_t report;
+  traceReportBegin(&report);
+
+  AsyncWebServerResponse *response = request->beginChunkedResponse("text/plain",
+    [report](uint8_t *buffer, size_t maxLen, size_t index) mutable -> size_t {
+      size_t length = 0;
+      int written;
+      while ((written = traceReportLine(&report, (char*)buffer + length, maxLen - length)) > 0) {
+        length += written;
+      }
+      if (length == 0 && written < 0) return RESPONSE_TRY_AGAIN;
+      return length;
+    });
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+}
+
+void handleLatencyReset(AsyncWebServerRequest *request) {
+  traceReset();
+  request->send(200, "text/plain", "OK");
+}
+
+void onPushConnect(AsyncEventSourceClient *client) {
+  bool added = false;
+  xSemaphoreTake(pushLock, portMAX_DELAY);
+  for (int i = 0; i < MAX_PUSH_CLIENTS && !added; i++) {
+    if (pushClients[i].client == NULL) {
+      pushClients[i].client = client;
+      pushClients[i].stale = true;
+      added = true;
+    }
+  }
+  xSemaphoreGive(pushLock);
+
+  if (!added) {
+    client->close();
+  }
+}
+
+void onPushDisconnect(AsyncEventSourceClient *client) {
+  xSemaphoreTake(pushLock, portMAX_DELAY);
+  for (int i = 0; i < MAX_PUSH_CLIENTS; i++) {
+    if (pushClients[i].client == client) {
+      pushClients[i].client = NULL;
+    }
+  }
+  xSemaphoreGive(pushLock);
+}
+
+// Groups whose values differ from the last push
+static uint32_t changedGroups(const PushedTelemetry_t* last, const TelemetryData_t* telemetry) {
+  if (!last->valid) return TELEMETRY_ALL;
 
-  server.send(200, "text/html", info);
+  uint32_t groups = 0;
+  if (memcmp(&last->battery, &telemetry->battery, sizeof(last->battery)) != 0) groups |= TELEMETRY_BATTERY;
+  if (memcmp(&last->attitude, &telemetry->attitude, sizeof(last->attitude)) != 0) groups |= TELEMETRY_ATTITUDE;
+  if (memcmp(&last->flightMode, &telemetry->flightMode, sizeof(last->flightMode)) != 0) groups |= TELEMETRY_FLIGHT_MODE;
+  if (memcmp(&last->gps, &telemetry->gps, sizeof(last->gps)) != 0) groups |= TELEMETRY_GPS;
+  return groups;
+}
+
+// Appends one vehicle to the JSON array in buffer, leaves room for "]".
+// Returns the new length, -1 if it does not fit (buffer is unchanged then).
+static int appendVehicle(char* buffer, int length, int size, const Vehicle_t* vehicle,
+                         const TelemetryData_t* telemetry, uint32_t groups) {
+  int start = length > 1 ? length + 1 : length;
+  int written = telemetryToJson(telemetry, vehicle->systemId, vehicle->mac, groups,
+                                buffer + start, size - start - 2);
+  if (written < 0) return -1;
+  if (start > length) buffer[length] = ',';
+  return start + written;
+}
+
+// Builds the delta and the full state as JSON arrays of vehicles.
+// Returns false if nothing changed.
+static bool buildPush() {
+  int deltaLength = 1;
+  int fullLength = 1;
+  TelemetryData_t telemetry;
+
+  pushDelta[0] = '[';
+  pushFull[0] = '[';
+
+  for (int i = 0; i < MAX_VEHICLES; i++) {
+    if (!vehicleSnapshot(i, &telemetry)) continue;
+    Vehicle_t* vehicle = vehicleAt(i);
+    PushedTelemetry_t* last = &pushed[i];
+
+    int length = appendVehicle(pushFull, fullLength, sizeof(pushFull), vehicle, &telemetry, TELEMETRY_ALL);
+    if (length >= 0) fullLength = length;
+
+    uint32_t groups = changedGroups(last, &telemetry);
+    if (groups != 0) {
+      length = appendVehicle(pushDelta, deltaLength, sizeof(pushDelta), vehicle, &telemetry, groups);
+      // Not pushed: keep the last state, so the change is sent next time
+      if (length < 0) continue;
+      deltaLength = length;
+    }
+
+    last->valid = true;
+    last->battery = telemetry.battery;
+    last->attitude = telemetry.attitude;
+    last->flightMode = telemetry.flightMode;
+    last->gps = telemetry.gps;
+  }
+
+  bool changed = deltaLength > 1;
+  strcpy(pushDelta + deltaLength, "]");
+  strcpy(pushFull + fullLength, "]");
+  return changed;
+}
+
+static void pushTelemetry() {
+  bool changed = buildPush();
+  pushId++;
+
+  xSemaphoreTake(pushLock, portMAX_DELAY);
+  for (int i = 0; i < MAX_PUSH_CLIENTS; i++) {
+    PushClient_t* push = &pushClients[i];
+    if (push->client == NULL) continue;
+
+    if (push->client->packetsWaiting() > 0) {
+      // Slow client: coalesce, it gets the full state later
+      push->stale = true;
+    } else if (push->stale) {
+      push->client->send(pushFull, "telemetry", pushId);
+      push->stale = false;
+    } else if (changed) {
+      push->client->send(pushDelta, "telemetry", pushId);
+    }
+  }
+  xSemaphoreGive(pushLock);
 }
 
 void webSwerverSetup() {
@@ -700,19 +464,45 @@ void webSwerverSetup() {
   loadWifiFromStorage();
 
     // Setting up a web server
-  server.on("/", handleRoot);
-  server.on("/current_mac", handleCurrentMac);
-  server.on("/current_wifi", handleCurrentWifi);
+  server.on("/", HTTP_GET, handleRoot);
+  server.on("/current_mac", HTTP_GET, handleCurrentMac);
+  server.on("/current_wifi", HTTP_GET, handleCurrentWifi);
   server.on("/save_mac", HTTP_POST, handleSaveMac);
-  server.on("/save_wifi", HTTP_POST, handleSaveWifi);
+  server.on("/save_wifi", HTTP_POST, handleSaveWifi, NULL, collectBody);
   server.on("/reset", HTTP_POST, handleReset);
-  server.on("/info", handleInfo);
+  server.on("/info", HTTP_GET, handleInfo);
+  server.on("/telemetry", HTTP_GET, handleTelemetry);
+  server.on("/capture/start", HTTP_POST, handleCaptureStart);
+  server.on("/capture", HTTP_GET, handleCapture);
+  server.on("/latency", HTTP_GET, handleLatency);
+  server.on("/latency/reset", HTTP_POST, handleLatencyReset);
+
+  pushLock = xSemaphoreCreateMutex();
+  events.onConnect(onPushConnect);
+  events.onDisconnect(onPushDisconnect);
+  server.addHandler(&events);
 
   server.begin();
   Serial.println("------------------------------------------------");
   Serial.println("HTTP server is running");
 }
 
+// Requests are handled asynchronously, here only the telemetry push
+// and a pending reboot are done. Sleeps afterwards, so that loopTask does
+// not spin on core 1 next to the telemetry task.
 void webServerRun() {
-    server.handleClient();
+  if (millis() - lastPush >= TELEMETRY_PUSH_INTERVAL_MS) {
+    lastPush = millis();
+    if (events.count() > 0) {
+      pushTelemetry();
+    }
+  }
+
+  if (rebootAt != 0 && (int32_t)(millis() - rebootAt) >= 0) {
+    Serial.println("ESP32 Device reboot...");
+    server.end();
+    ESP.restart();
+  }
+
+  delay(WEB_SERVER_IDLE_MS);
 }
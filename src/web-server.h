@@ -1,6 +1,13 @@
 #ifndef _WEB_SERVER_H_
 #define _WEB_SERVER_H_
 
+#define WEB_BODY_MAX_LEN        512     // largest accepted POST body
+#define WEB_REBOOT_DELAY_MS     500     // time to deliver the reply before reboot
+#define TELEMETRY_PUSH_INTERVAL_MS  200 // live telemetry rate on /events
+#define MAX_PUSH_CLIENTS        4
+#define PUSH_VEHICLE_JSON_MAX   480     // every group, flight mode fully escaped: ~450
+#define WEB_SERVER_IDLE_MS      10      // loop() sleep, requests need no polling
+
 void webSwerverSetup();
 void webServerRun();
 